@@ -887,133 +887,206 @@ namespace glTFRuntimeAlembic
 		return Metadata;
 	}
 
-	bool BuildMatrix(const uint32 OpsTrueSampleIndex, const TSharedRef<FScalarProperty>& Ops, const uint32 ValsTrueSampleIndex, const TSharedRef<FScalarProperty>& Vals, FMatrix& Matrix)
+	namespace Xform
 	{
-		Matrix.SetIdentity();
-		uint8 CurrentValsOffset = 0;
-		for (uint8 ExtentIndex = 0; ExtentIndex < Ops->Extent; ExtentIndex++)
+		// .ops and .vals of a sample, read once (the extent of a property is at most 255)
+		struct FXformOps
 		{
-			FMatrix OpMatrix = FMatrix::Identity;
-			uint8 OpTypeAsUint8;
-			if (!Ops->Get(OpsTrueSampleIndex, ExtentIndex, OpTypeAsUint8))
-			{
-				return false;
-			}
-
-			const EglTFRuntimeAlembicXformOpType OpType = static_cast<EglTFRuntimeAlembicXformOpType>((OpTypeAsUint8 >> 4) & 0xF);
+			EglTFRuntimeAlembicXformOpType OpTypes[MAX_uint8];
+			double Vals[MAX_uint8];
+			int32 NumOps = 0;
+			int32 NumVals = 0;
 
-			switch (OpType)
-			{
-			case(EglTFRuntimeAlembicXformOpType::Matrix):
-			{
-				for (uint8 Row = 0; Row < 4; Row++)
-				{
-					for (uint8 Col = 0; Col < 4; Col++)
-					{
-						if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, OpMatrix.M[Row][Col]))
-						{
-							return false;
-						}
-					}
-				}
-				break;
-			}
-			case(EglTFRuntimeAlembicXformOpType::Translate):
+			bool Read(const uint32 OpsTrueSampleIndex, FScalarProperty& OpsProperty, const uint32 ValsTrueSampleIndex, FScalarProperty& ValsProperty)
 			{
-				FVector Delta = FVector::ZeroVector;
-				if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, Delta.X))
+				NumOps = OpsProperty.Extent;
+				NumVals = ValsProperty.Extent;
+
+				// no ops is the identity
+				if (NumOps == 0)
 				{
-					return false;
+					return true;
 				}
-				if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, Delta.Y))
+
+				uint8 OpTypesAsUint8[MAX_uint8];
+				if (!OpsProperty.GetExtent(OpsTrueSampleIndex, MakeArrayView(OpTypesAsUint8, MAX_uint8)))
 				{
 					return false;
 				}
-				if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, Delta.Z))
+
+				for (int32 OpIndex = 0; OpIndex < NumOps; OpIndex++)
 				{
-					return false;
+					OpTypes[OpIndex] = static_cast<EglTFRuntimeAlembicXformOpType>((OpTypesAsUint8[OpIndex] >> 4) & 0xF);
 				}
-				OpMatrix = FTranslationMatrix(Delta);
-				break;
+
+				return NumVals == 0 || ValsProperty.GetExtent(ValsTrueSampleIndex, MakeArrayView(Vals, MAX_uint8));
 			}
-			case(EglTFRuntimeAlembicXformOpType::Scale):
+		};
+
+		int32 GetNumOpVals(const EglTFRuntimeAlembicXformOpType OpType)
+		{
+			switch (OpType)
 			{
-				FVector Scale = FVector::OneVector;
-				if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, Scale.X))
-				{
-					return false;
-				}
-				if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, Scale.Y))
-				{
-					return false;
-				}
-				if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, Scale.Z))
-				{
-					return false;
-				}
-				OpMatrix = FScaleMatrix(Scale);
+			case(EglTFRuntimeAlembicXformOpType::Matrix):
+				return 16;
+			case(EglTFRuntimeAlembicXformOpType::Translate):
+			case(EglTFRuntimeAlembicXformOpType::Scale):
+				return 3;
+			case(EglTFRuntimeAlembicXformOpType::RotateX):
+			case(EglTFRuntimeAlembicXformOpType::RotateY):
+			case(EglTFRuntimeAlembicXformOpType::RotateZ):
+				return 1;
+			case(EglTFRuntimeAlembicXformOpType::Rotate):
+				return 4;
+			default:
 				break;
 			}
-			case(EglTFRuntimeAlembicXformOpType::RotateX):
+			return 0;
+		}
+
+		FQuat GetOpRotation(const EglTFRuntimeAlembicXformOpType OpType, const double* Vals)
+		{
+			switch (OpType)
 			{
-				double Degrees = 0;
-				if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, Degrees))
-				{
-					return false;
-				}
-				OpMatrix = FQuatRotationMatrix(FQuat(FVector(1, 0, 0), FMath::DegreesToRadians(Degrees)));
+			case(EglTFRuntimeAlembicXformOpType::RotateX):
+				return FQuat(FVector(1, 0, 0), FMath::DegreesToRadians(Vals[0]));
+			case(EglTFRuntimeAlembicXformOpType::RotateY):
+				return FQuat(FVector(0, 1, 0), FMath::DegreesToRadians(Vals[0]));
+			case(EglTFRuntimeAlembicXformOpType::RotateZ):
+				return FQuat(FVector(0, 0, 1), FMath::DegreesToRadians(Vals[0]));
+			default:
 				break;
 			}
-			case(EglTFRuntimeAlembicXformOpType::RotateY):
+			return FQuat(FVector(Vals[0], Vals[1], Vals[2]), FMath::DegreesToRadians(Vals[3]));
+		}
+
+		bool ComposeMatrix(const FXformOps& XformOps, FMatrix& Matrix)
+		{
+			Matrix.SetIdentity();
+			int32 CurrentValsOffset = 0;
+			for (int32 OpIndex = 0; OpIndex < XformOps.NumOps; OpIndex++)
 			{
-				double Degrees = 0;
-				if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, Degrees))
+				const EglTFRuntimeAlembicXformOpType OpType = XformOps.OpTypes[OpIndex];
+				const int32 NumOpVals = GetNumOpVals(OpType);
+				if (NumOpVals == 0 || CurrentValsOffset + NumOpVals > XformOps.NumVals)
 				{
 					return false;
 				}
-				OpMatrix = FQuatRotationMatrix(FQuat(FVector(0, 1, 0), FMath::DegreesToRadians(Degrees)));
-				break;
-			}
-			case(EglTFRuntimeAlembicXformOpType::RotateZ):
-			{
-				double Degrees = 0;
-				if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, Degrees))
+
+				const double* Vals = XformOps.Vals + CurrentValsOffset;
+				CurrentValsOffset += NumOpVals;
+
+				FMatrix OpMatrix;
+				switch (OpType)
 				{
-					return false;
+				case(EglTFRuntimeAlembicXformOpType::Matrix):
+				{
+					for (int32 Row = 0; Row < 4; Row++)
+					{
+						for (int32 Col = 0; Col < 4; Col++)
+						{
+							OpMatrix.M[Row][Col] = Vals[Row * 4 + Col];
+						}
+					}
+					break;
 				}
-				OpMatrix = FQuatRotationMatrix(FQuat(FVector(0, 0, 1), FMath::DegreesToRadians(Degrees)));
-				break;
+				case(EglTFRuntimeAlembicXformOpType::Translate):
+					OpMatrix = FTranslationMatrix(FVector(Vals[0], Vals[1], Vals[2]));
+					break;
+				case(EglTFRuntimeAlembicXformOpType::Scale):
+					OpMatrix = FScaleMatrix(FVector(Vals[0], Vals[1], Vals[2]));
+					break;
+				default:
+					OpMatrix = FQuatRotationMatrix(GetOpRotation(OpType, Vals));
+					break;
+				}
+
+				Matrix = OpMatrix * Matrix;
 			}
-			case(EglTFRuntimeAlembicXformOpType::Rotate):
+
+			return true;
+		}
+
+		// translates, then rotates, then scales: the product of the op matrices is exactly a TRS (scales are applied first, translations last)
+		bool ComposeTRS(const FXformOps& XformOps, FTransform& Transform)
+		{
+			FVector Translation = FVector::ZeroVector;
+			FQuat Rotation = FQuat::Identity;
+			FVector Scale = FVector::OneVector;
+
+			// 0 translate, 1 rotate, 2 scale: the stage can only move forward
+			int32 Stage = 0;
+			int32 CurrentValsOffset = 0;
+			for (int32 OpIndex = 0; OpIndex < XformOps.NumOps; OpIndex++)
 			{
-				FVector Axis = FVector::ZeroVector;
-				if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, Axis.X))
+				const EglTFRuntimeAlembicXformOpType OpType = XformOps.OpTypes[OpIndex];
+				const int32 NumOpVals = GetNumOpVals(OpType);
+				if (NumOpVals == 0 || OpType == EglTFRuntimeAlembicXformOpType::Matrix || CurrentValsOffset + NumOpVals > XformOps.NumVals)
 				{
 					return false;
 				}
-				if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, Axis.Y))
+
+				const double* Vals = XformOps.Vals + CurrentValsOffset;
+				CurrentValsOffset += NumOpVals;
+
+				const int32 OpStage = OpType == EglTFRuntimeAlembicXformOpType::Translate ? 0 : (OpType == EglTFRuntimeAlembicXformOpType::Scale ? 2 : 1);
+				if (OpStage < Stage)
 				{
 					return false;
 				}
-				if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, Axis.Z))
+				Stage = OpStage;
+
+				if (OpStage == 0)
 				{
-					return false;
+					Translation += FVector(Vals[0], Vals[1], Vals[2]);
 				}
-				double Degrees = 0;
-				if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, Degrees))
+				else if (OpStage == 1)
 				{
-					return false;
+					// later ops are applied first
+					Rotation = Rotation * GetOpRotation(OpType, Vals);
+				}
+				else
+				{
+					Scale *= FVector(Vals[0], Vals[1], Vals[2]);
 				}
-				OpMatrix = FQuatRotationMatrix(FQuat(Axis, FMath::DegreesToRadians(Degrees)));
-				break;
-			}
-			default:
-				return false;
 			}
 
-			Matrix = OpMatrix * Matrix;
+			Transform = FTransform(Rotation, Translation, Scale);
+			return true;
+		}
+	}
+
+	bool BuildMatrix(const uint32 OpsTrueSampleIndex, const TSharedRef<FScalarProperty>& Ops, const uint32 ValsTrueSampleIndex, const TSharedRef<FScalarProperty>& Vals, FMatrix& Matrix)
+	{
+		Xform::FXformOps XformOps;
+		if (!XformOps.Read(OpsTrueSampleIndex, *Ops, ValsTrueSampleIndex, *Vals))
+		{
+			return false;
+		}
+
+		return Xform::ComposeMatrix(XformOps, Matrix);
+	}
+
+	bool BuildTransform(const uint32 OpsTrueSampleIndex, const TSharedRef<FScalarProperty>& Ops, const uint32 ValsTrueSampleIndex, const TSharedRef<FScalarProperty>& Vals, FTransform& Transform)
+	{
+		Xform::FXformOps XformOps;
+		if (!XformOps.Read(OpsTrueSampleIndex, *Ops, ValsTrueSampleIndex, *Vals))
+		{
+			return false;
+		}
+
+		if (Xform::ComposeTRS(XformOps, Transform))
+		{
+			return true;
+		}
+
+		FMatrix Matrix;
+		if (!Xform::ComposeMatrix(XformOps, Matrix))
+		{
+			return false;
 		}
 
+		Transform = FTransform(Matrix);
 		return true;
 	}
 }
\ No newline at end of file
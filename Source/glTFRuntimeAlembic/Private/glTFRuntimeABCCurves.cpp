@@ -0,0 +1,175 @@
+// Copyright 2025 - Roberto De Ioris
+
+#include "glTFRuntimeABCCurves.h"
+#include "Async/ParallelFor.h"
+
+namespace glTFRuntimeAlembic
+{
+	bool ReadCurvesSample(const FObject& Object, const uint32 SampleIndex, FCurvesSample& Sample)
+	{
+		TSharedPtr<FArrayProperty> NumVerticesProperty = Object.FindArrayProperty(".geom/nVertices");
+		TSharedPtr<FArrayProperty> PositionsProperty = Object.FindArrayProperty(".geom/P");
+		if (!NumVerticesProperty || !PositionsProperty || PositionsProperty->Extent != 3)
+		{
+			return false;
+		}
+
+		if (!NumVerticesProperty->GetSampleTrueIndex(SampleIndex, Sample.NumVerticesTrueSampleIndex) ||
+			!PositionsProperty->GetSampleTrueIndex(SampleIndex, Sample.PositionsTrueSampleIndex))
+		{
+			return false;
+		}
+
+		TArray<int32> NumVertices;
+		if (!NumVerticesProperty->GetValues(Sample.NumVerticesTrueSampleIndex, NumVertices))
+		{
+			return false;
+		}
+
+		// prefix sum of the vertex counts
+		Sample.Offsets.SetNumUninitialized(NumVertices.Num() + 1, EAllowShrinking::No);
+		int64 Offset = 0;
+		for (int32 StrandIndex = 0; StrandIndex < NumVertices.Num(); StrandIndex++)
+		{
+			Sample.Offsets[StrandIndex] = static_cast<int32>(Offset);
+			if (NumVertices[StrandIndex] < 0)
+			{
+				return false;
+			}
+			Offset += NumVertices[StrandIndex];
+			if (Offset > MAX_int32)
+			{
+				return false;
+			}
+		}
+		Sample.Offsets[NumVertices.Num()] = static_cast<int32>(Offset);
+
+		if (PositionsProperty->Num(Sample.PositionsTrueSampleIndex) != static_cast<uint64>(Offset))
+		{
+			return false;
+		}
+
+		static_assert(sizeof(FVector3f) == sizeof(float) * 3, "FVector3f must be 3 contiguous floats");
+		Sample.Positions.SetNumUninitialized(Offset, EAllowShrinking::No);
+		return PositionsProperty->GetValues(Sample.PositionsTrueSampleIndex, TArrayView<float>(reinterpret_cast<float*>(Sample.Positions.GetData()), Offset * 3));
+	}
+
+	bool ReadCurvesAttribute(const FObject& Object, const FString& PropertyPath, const uint32 SampleIndex, const FCurvesSample& Sample, FCurvesAttribute& Attribute)
+	{
+		Attribute = FCurvesAttribute();
+
+		FGeomParamSample GeomParam;
+		if (!ReadGeomParam(Object, PropertyPath, SampleIndex, GeomParam) || GeomParam.Extent == 0)
+		{
+			return false;
+		}
+
+		const int32 NumStrands = Sample.NumStrands();
+		const int32 NumVertices = Sample.Positions.Num();
+		const int32 NumElements = GeomParam.Indices.Num() > 0 ? GeomParam.Indices.Num() : GeomParam.NumElements();
+
+		// varying values of cubic curves sit at the ends of the segments: nVertices - 2 per strand (b-splines and catmull-rom) or (nVertices - 1) / 3 + 1 (beziers)
+		TArray<int32> VaryingOffsets;
+		auto BuildVaryingOffsets = [&](TFunctionRef<int32(const int32)> NumVaryingValues)
+			{
+				VaryingOffsets.SetNumUninitialized(NumStrands + 1, EAllowShrinking::No);
+				int64 Offset = 0;
+				for (int32 StrandIndex = 0; StrandIndex < NumStrands; StrandIndex++)
+				{
+					VaryingOffsets[StrandIndex] = static_cast<int32>(Offset);
+					Offset += FMath::Max(NumVaryingValues(Sample.NumVertices(StrandIndex)), 1);
+				}
+				VaryingOffsets[NumStrands] = static_cast<int32>(FMath::Min<int64>(Offset, MAX_int32));
+				return Offset == NumElements;
+			};
+
+		if (GeomParam.Scope != EGeomScope::Vertex && GeomParam.Scope != EGeomScope::Uniform && GeomParam.Scope != EGeomScope::Constant)
+		{
+			if (NumElements == NumVertices)
+			{
+				GeomParam.Scope = EGeomScope::Vertex;
+			}
+			else if (NumElements == NumStrands)
+			{
+				GeomParam.Scope = EGeomScope::Uniform;
+			}
+			else if (NumElements == 1)
+			{
+				GeomParam.Scope = EGeomScope::Constant;
+			}
+			else if (BuildVaryingOffsets([](const int32 StrandNumVertices) { return StrandNumVertices - 2; }) ||
+				BuildVaryingOffsets([](const int32 StrandNumVertices) { return (StrandNumVertices - 1) / 3 + 1; }))
+			{
+				GeomParam.Scope = EGeomScope::Varying;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		if ((GeomParam.Scope == EGeomScope::Vertex && NumElements != NumVertices) ||
+			(GeomParam.Scope == EGeomScope::Uniform && NumElements != NumStrands) ||
+			NumElements == 0)
+		{
+			return false;
+		}
+
+		Attribute.Extent = GeomParam.Extent;
+		Attribute.bPerVertex = GeomParam.Scope == EGeomScope::Vertex || GeomParam.Scope == EGeomScope::Varying;
+		const uint32 NumGeomParamElements = GeomParam.NumElements();
+
+		// every vertex of a strand gets the blend of the two varying values around its (linearly remapped) position
+		if (GeomParam.Scope == EGeomScope::Varying)
+		{
+			Attribute.Values.SetNumZeroed(NumVertices * Attribute.Extent, EAllowShrinking::No);
+
+			ParallelFor(NumStrands, [&](const int32 StrandIndex)
+				{
+					const int32 StrandNumVertices = Sample.NumVertices(StrandIndex);
+					const int32 NumVaryingValues = VaryingOffsets[StrandIndex + 1] - VaryingOffsets[StrandIndex];
+					for (int32 VertexIndex = 0; VertexIndex < StrandNumVertices; VertexIndex++)
+					{
+						const float VaryingPosition = StrandNumVertices > 1 ? static_cast<float>(VertexIndex * (NumVaryingValues - 1)) / (StrandNumVertices - 1) : 0;
+						const int32 VaryingIndex = FMath::Min(FMath::FloorToInt32(VaryingPosition), NumVaryingValues - 1);
+						const int32 NextVaryingIndex = FMath::Min(VaryingIndex + 1, NumVaryingValues - 1);
+						const float Alpha = VaryingPosition - VaryingIndex;
+
+						const uint32 ElementIndex = GeomParam.GetElementIndex(0, 0, VaryingOffsets[StrandIndex] + VaryingIndex);
+						const uint32 NextElementIndex = GeomParam.GetElementIndex(0, 0, VaryingOffsets[StrandIndex] + NextVaryingIndex);
+						if (ElementIndex >= NumGeomParamElements || NextElementIndex >= NumGeomParamElements)
+						{
+							continue;
+						}
+
+						float* Value = Attribute.Values.GetData() + (Sample.Offsets[StrandIndex] + VertexIndex) * Attribute.Extent;
+						for (uint8 Component = 0; Component < Attribute.Extent; Component++)
+						{
+							Value[Component] = FMath::Lerp(GeomParam.Values[ElementIndex * Attribute.Extent + Component], GeomParam.Values[NextElementIndex * Attribute.Extent + Component], Alpha);
+						}
+					}
+				});
+
+			return true;
+		}
+
+		const int32 NumValues = Attribute.bPerVertex ? NumVertices : NumStrands;
+		Attribute.Values.SetNumUninitialized(NumValues * Attribute.Extent, EAllowShrinking::No);
+
+		ParallelFor(NumValues, [&](const int32 ValueIndex)
+			{
+				const uint32 ElementIndex = GeomParam.GetElementIndex(ValueIndex, ValueIndex, ValueIndex);
+				float* Value = Attribute.Values.GetData() + ValueIndex * Attribute.Extent;
+				if (ElementIndex < NumGeomParamElements)
+				{
+					FMemory::Memcpy(Value, GeomParam.Values.GetData() + ElementIndex * Attribute.Extent, Attribute.Extent * sizeof(float));
+				}
+				else
+				{
+					FMemory::Memzero(Value, Attribute.Extent * sizeof(float));
+				}
+			});
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,536 @@
+// Copyright 2025 - Roberto De Ioris
+
+#include "glTFRuntimeABCFrameStore.h"
+#include "glTFRuntimeAlembicStats.h"
+#include "Async/ParallelFor.h"
+
+namespace glTFRuntimeAlembic
+{
+	namespace FrameStore
+	{
+		// quantized channels are stored planar (all the vertices of a channel are contiguous) so that channels not changing between frames end in 8 bit chunks:
+		// 3 for the position, 2 for the normal and 2 for the tangent (with the bitangent sign in the lowest bit)
+		constexpr int32 NumChannels = 7;
+		constexpr int32 NormalsChannel = 3;
+		constexpr int32 TangentsChannel = 5;
+
+		// deltas are stored with the smallest width fitting all the values of a chunk
+		constexpr int32 DeltaChunkSize = 256;
+
+		void EncodeDeltas(const TArrayView<const uint16> Values, const TArrayView<const uint16> PreviousValues, TArray<uint8>& Data)
+		{
+			for (int32 FirstValueIndex = 0; FirstValueIndex < Values.Num(); FirstValueIndex += DeltaChunkSize)
+			{
+				const int32 NumChunkValues = FMath::Min(DeltaChunkSize, Values.Num() - FirstValueIndex);
+
+				int16 Deltas[DeltaChunkSize];
+				bool bFits8Bit = true;
+				for (int32 ChunkValueIndex = 0; ChunkValueIndex < NumChunkValues; ChunkValueIndex++)
+				{
+					// wrapping arithmetic keeps the deltas lossless
+					Deltas[ChunkValueIndex] = static_cast<int16>(static_cast<uint16>(Values[FirstValueIndex + ChunkValueIndex] - PreviousValues[FirstValueIndex + ChunkValueIndex]));
+					bFits8Bit &= Deltas[ChunkValueIndex] >= MIN_int8 && Deltas[ChunkValueIndex] <= MAX_int8;
+				}
+
+				const uint8 Width = bFits8Bit ? 1 : 2;
+				const int32 Offset = Data.AddUninitialized(1 + NumChunkValues * Width);
+				Data[Offset] = Width;
+				if (bFits8Bit)
+				{
+					for (int32 ChunkValueIndex = 0; ChunkValueIndex < NumChunkValues; ChunkValueIndex++)
+					{
+						Data[Offset + 1 + ChunkValueIndex] = static_cast<uint8>(static_cast<int8>(Deltas[ChunkValueIndex]));
+					}
+				}
+				else
+				{
+					FMemory::Memcpy(Data.GetData() + Offset + 1, Deltas, NumChunkValues * sizeof(int16));
+				}
+			}
+		}
+
+		bool DecodeDeltas(const TArray<uint8>& Data, TArray<uint16>& Values)
+		{
+			int32 Offset = 0;
+			for (int32 FirstValueIndex = 0; FirstValueIndex < Values.Num(); FirstValueIndex += DeltaChunkSize)
+			{
+				const int32 NumChunkValues = FMath::Min(DeltaChunkSize, Values.Num() - FirstValueIndex);
+				if (Offset >= Data.Num())
+				{
+					return false;
+				}
+
+				const uint8 Width = Data[Offset++];
+				if (Width < 1 || Width > 2 || Offset + NumChunkValues * Width > Data.Num())
+				{
+					return false;
+				}
+
+				uint16* ChunkValues = Values.GetData() + FirstValueIndex;
+				if (Width == 1)
+				{
+					const int8* Deltas = reinterpret_cast<const int8*>(Data.GetData() + Offset);
+					for (int32 ChunkValueIndex = 0; ChunkValueIndex < NumChunkValues; ChunkValueIndex++)
+					{
+						ChunkValues[ChunkValueIndex] += static_cast<uint16>(Deltas[ChunkValueIndex]);
+					}
+				}
+				else
+				{
+					int16 Deltas[DeltaChunkSize];
+					FMemory::Memcpy(Deltas, Data.GetData() + Offset, NumChunkValues * sizeof(int16));
+					for (int32 ChunkValueIndex = 0; ChunkValueIndex < NumChunkValues; ChunkValueIndex++)
+					{
+						ChunkValues[ChunkValueIndex] += static_cast<uint16>(Deltas[ChunkValueIndex]);
+					}
+				}
+
+				Offset += NumChunkValues * Width;
+			}
+
+			return true;
+		}
+
+		uint16 QuantizeUnit(const double Value)
+		{
+			return static_cast<uint16>(FMath::Clamp(FMath::RoundToInt32((Value * 0.5 + 0.5) * MAX_uint16), 0, static_cast<int32>(MAX_uint16)));
+		}
+
+		double DequantizeUnit(const uint16 Value)
+		{
+			return (Value / static_cast<double>(MAX_uint16)) * 2.0 - 1.0;
+		}
+	}
+
+	void EncodeOctahedron(const FVector& Vector, uint16& U, uint16& V)
+	{
+		const double L1Norm = FMath::Abs(Vector.X) + FMath::Abs(Vector.Y) + FMath::Abs(Vector.Z);
+		if (L1Norm <= UE_DOUBLE_SMALL_NUMBER)
+		{
+			U = FrameStore::QuantizeUnit(0);
+			V = FrameStore::QuantizeUnit(0);
+			return;
+		}
+
+		double X = Vector.X / L1Norm;
+		double Y = Vector.Y / L1Norm;
+		// fold the lower hemisphere over the diagonals
+		if (Vector.Z < 0)
+		{
+			const double FoldedX = (1.0 - FMath::Abs(Y)) * (X >= 0 ? 1.0 : -1.0);
+			const double FoldedY = (1.0 - FMath::Abs(X)) * (Y >= 0 ? 1.0 : -1.0);
+			X = FoldedX;
+			Y = FoldedY;
+		}
+
+		U = FrameStore::QuantizeUnit(X);
+		V = FrameStore::QuantizeUnit(Y);
+	}
+
+	FVector DecodeOctahedron(const uint16 U, const uint16 V)
+	{
+		const double X = FrameStore::DequantizeUnit(U);
+		const double Y = FrameStore::DequantizeUnit(V);
+		const double Z = 1.0 - FMath::Abs(X) - FMath::Abs(Y);
+
+		FVector Vector(X, Y, Z);
+		if (Z < 0)
+		{
+			Vector.X = (1.0 - FMath::Abs(Y)) * (X >= 0 ? 1.0 : -1.0);
+			Vector.Y = (1.0 - FMath::Abs(X)) * (Y >= 0 ? 1.0 : -1.0);
+		}
+
+		return Vector.GetSafeNormal();
+	}
+
+	bool FCompressedFrameStore::MatchesLayout(const FglTFRuntimeMeshLOD& RuntimeLOD) const
+	{
+		if (RuntimeLOD.Primitives.Num() != Layout.Primitives.Num())
+		{
+			return false;
+		}
+
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < RuntimeLOD.Primitives.Num(); PrimitiveIndex++)
+		{
+			const FglTFRuntimePrimitive& Primitive = RuntimeLOD.Primitives[PrimitiveIndex];
+			const int32 NumPrimitiveVertices = (PrimitiveIndex + 1 < PrimitivesFirstVertex.Num() ? PrimitivesFirstVertex[PrimitiveIndex + 1] : NumVertices) - PrimitivesFirstVertex[PrimitiveIndex];
+			if (Primitive.Positions.Num() != NumPrimitiveVertices ||
+				Primitive.Normals.Num() != NumPrimitiveVertices ||
+				Primitive.Tangents.Num() != NumPrimitiveVertices ||
+				Primitive.Indices != Layout.Primitives[PrimitiveIndex].Indices)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void FCompressedFrameStore::Quantize(const FglTFRuntimeMeshLOD& RuntimeLOD, const FBlock& Block, TArray<uint16>& Values) const
+	{
+		Values.SetNumUninitialized(NumVertices * FrameStore::NumChannels, EAllowShrinking::No);
+
+		const FVector InvScale(Block.Scale.X > 0 ? 1.0 / Block.Scale.X : 0, Block.Scale.Y > 0 ? 1.0 / Block.Scale.Y : 0, Block.Scale.Z > 0 ? 1.0 / Block.Scale.Z : 0);
+
+		ParallelFor(RuntimeLOD.Primitives.Num(), [&](const int32 PrimitiveIndex)
+			{
+				const FglTFRuntimePrimitive& Primitive = RuntimeLOD.Primitives[PrimitiveIndex];
+				uint16* Channels[FrameStore::NumChannels];
+				for (int32 ChannelIndex = 0; ChannelIndex < FrameStore::NumChannels; ChannelIndex++)
+				{
+					Channels[ChannelIndex] = Values.GetData() + ChannelIndex * NumVertices + PrimitivesFirstVertex[PrimitiveIndex];
+				}
+
+				for (int32 VertexIndex = 0; VertexIndex < Primitive.Positions.Num(); VertexIndex++)
+				{
+					const FVector Position = (Primitive.Positions[VertexIndex] - Block.Min) * InvScale;
+					Channels[0][VertexIndex] = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt32(Position.X), 0, static_cast<int32>(MAX_uint16)));
+					Channels[1][VertexIndex] = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt32(Position.Y), 0, static_cast<int32>(MAX_uint16)));
+					Channels[2][VertexIndex] = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt32(Position.Z), 0, static_cast<int32>(MAX_uint16)));
+
+					EncodeOctahedron(Primitive.Normals[VertexIndex], Channels[FrameStore::NormalsChannel][VertexIndex], Channels[FrameStore::NormalsChannel + 1][VertexIndex]);
+
+					const FVector4& Tangent = Primitive.Tangents[VertexIndex];
+					uint16& TangentV = Channels[FrameStore::TangentsChannel + 1][VertexIndex];
+					EncodeOctahedron(FVector(Tangent), Channels[FrameStore::TangentsChannel][VertexIndex], TangentV);
+					TangentV = static_cast<uint16>((TangentV & ~1) | (Tangent.W < 0 ? 1 : 0));
+				}
+			});
+	}
+
+	bool FCompressedFrameStore::AddBlock(const TArrayView<const FglTFRuntimeMeshLOD> BlockFrames)
+	{
+		if (BlockFrames.Num() == 0)
+		{
+			return false;
+		}
+
+		if (!bHasLayout)
+		{
+			Layout = BlockFrames[0];
+			NumVertices = 0;
+			PrimitivesFirstVertex.Reset();
+			for (FglTFRuntimePrimitive& Primitive : Layout.Primitives)
+			{
+				PrimitivesFirstVertex.Add(NumVertices);
+				NumVertices += Primitive.Positions.Num();
+				Primitive.Positions.Empty();
+				Primitive.Normals.Empty();
+				Primitive.Tangents.Empty();
+			}
+			bHasLayout = true;
+		}
+
+		FBox Bounds(ForceInit);
+		for (const FglTFRuntimeMeshLOD& RuntimeLOD : BlockFrames)
+		{
+			if (!MatchesLayout(RuntimeLOD))
+			{
+				return false;
+			}
+
+			for (const FglTFRuntimePrimitive& Primitive : RuntimeLOD.Primitives)
+			{
+				for (const FVector& Position : Primitive.Positions)
+				{
+					Bounds += Position;
+				}
+			}
+		}
+
+		FBlock& Block = Blocks.AddDefaulted_GetRef();
+		Block.FirstFrameIndex = Frames.Num();
+		if (Bounds.IsValid)
+		{
+			Block.Min = Bounds.Min;
+			Block.Scale = (Bounds.Max - Bounds.Min) / MAX_uint16;
+		}
+
+		TArray<uint16> PreviousValues;
+		TArray<uint16> Values;
+		for (int32 BlockFrameIndex = 0; BlockFrameIndex < BlockFrames.Num(); BlockFrameIndex++)
+		{
+			Quantize(BlockFrames[BlockFrameIndex], Block, Values);
+
+			FFrame& Frame = Frames.AddDefaulted_GetRef();
+			Frame.BlockIndex = Blocks.Num() - 1;
+			Frame.bKeyframe = BlockFrameIndex == 0;
+			if (Frame.bKeyframe)
+			{
+				Frame.Data.Append(reinterpret_cast<const uint8*>(Values.GetData()), Values.Num() * sizeof(uint16));
+			}
+			else
+			{
+				FrameStore::EncodeDeltas(Values, PreviousValues, Frame.Data);
+			}
+
+			Swap(Values, PreviousValues);
+		}
+
+		return true;
+	}
+
+	bool FCompressedFrameStore::DecodeFrame(const int32 FrameIndex, FglTFRuntimeMeshLOD& RuntimeLOD) const
+	{
+		SCOPE_CYCLE_COUNTER(STAT_glTFRuntimeAlembic_FrameStoreDecode);
+
+		if (!Frames.IsValidIndex(FrameIndex))
+		{
+			return false;
+		}
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		const FBlock& Block = Blocks[Frames[FrameIndex].BlockIndex];
+		const FFrame& Keyframe = Frames[Block.FirstFrameIndex];
+		if (Keyframe.Data.Num() != NumVertices * FrameStore::NumChannels * static_cast<int32>(sizeof(uint16)))
+		{
+			return false;
+		}
+
+		TArray<uint16> Values;
+		Values.SetNumUninitialized(NumVertices * FrameStore::NumChannels);
+		FMemory::Memcpy(Values.GetData(), Keyframe.Data.GetData(), Keyframe.Data.Num());
+
+		for (int32 DeltaFrameIndex = Block.FirstFrameIndex + 1; DeltaFrameIndex <= FrameIndex; DeltaFrameIndex++)
+		{
+			if (!FrameStore::DecodeDeltas(Frames[DeltaFrameIndex].Data, Values))
+			{
+				return false;
+			}
+		}
+
+		RuntimeLOD = Layout;
+
+		ParallelFor(RuntimeLOD.Primitives.Num(), [&](const int32 PrimitiveIndex)
+			{
+				FglTFRuntimePrimitive& Primitive = RuntimeLOD.Primitives[PrimitiveIndex];
+				const int32 FirstVertex = PrimitivesFirstVertex[PrimitiveIndex];
+				const int32 NumPrimitiveVertices = (PrimitiveIndex + 1 < PrimitivesFirstVertex.Num() ? PrimitivesFirstVertex[PrimitiveIndex + 1] : NumVertices) - FirstVertex;
+				const uint16* Channels[FrameStore::NumChannels];
+				for (int32 ChannelIndex = 0; ChannelIndex < FrameStore::NumChannels; ChannelIndex++)
+				{
+					Channels[ChannelIndex] = Values.GetData() + ChannelIndex * NumVertices + FirstVertex;
+				}
+
+				Primitive.Positions.SetNumUninitialized(NumPrimitiveVertices);
+				Primitive.Normals.SetNumUninitialized(NumPrimitiveVertices);
+				Primitive.Tangents.SetNumUninitialized(NumPrimitiveVertices);
+
+				for (int32 VertexIndex = 0; VertexIndex < NumPrimitiveVertices; VertexIndex++)
+				{
+					Primitive.Positions[VertexIndex] = Block.Min + FVector(Channels[0][VertexIndex], Channels[1][VertexIndex], Channels[2][VertexIndex]) * Block.Scale;
+					Primitive.Normals[VertexIndex] = DecodeOctahedron(Channels[FrameStore::NormalsChannel][VertexIndex], Channels[FrameStore::NormalsChannel + 1][VertexIndex]);
+					const uint16 TangentV = Channels[FrameStore::TangentsChannel + 1][VertexIndex];
+					Primitive.Tangents[VertexIndex] = FVector4(DecodeOctahedron(Channels[FrameStore::TangentsChannel][VertexIndex], TangentV), (TangentV & 1) ? -1 : 1);
+				}
+			});
+
+		DecodeCycles += FPlatformTime::Cycles64() - StartCycles;
+		DecodedBytes += static_cast<int64>(NumVertices) * (sizeof(FVector) * 2 + sizeof(FVector4));
+
+		return true;
+	}
+
+	int64 FCompressedFrameStore::GetCompressedSize() const
+	{
+		int64 Size = Blocks.Num() * sizeof(FBlock);
+		for (const FFrame& Frame : Frames)
+		{
+			Size += Frame.Data.Num();
+		}
+		return Size;
+	}
+
+	int64 FCompressedFrameStore::GetUncompressedSize() const
+	{
+		return static_cast<int64>(Frames.Num()) * NumVertices * (sizeof(FVector) * 2 + sizeof(FVector4));
+	}
+
+	float FCompressedFrameStore::GetCompressionRatio() const
+	{
+		const int64 CompressedSize = GetCompressedSize();
+		return CompressedSize > 0 ? static_cast<float>(static_cast<double>(GetUncompressedSize()) / CompressedSize) : 0;
+	}
+
+	double FCompressedFrameStore::GetDecodeThroughput() const
+	{
+		const double Seconds = FPlatformTime::ToSeconds64(DecodeCycles);
+		return Seconds > 0 ? (DecodedBytes / Seconds) / (1024 * 1024) : 0;
+	}
+
+	bool FCompressedCurvesStore::Build(const FObject& Object, const int32 KeyframeInterval)
+	{
+		TSharedPtr<FArrayProperty> PositionsProperty = Object.FindArrayProperty(".geom/P");
+		if (!PositionsProperty)
+		{
+			return false;
+		}
+
+		const int32 NumSamples = static_cast<int32>(PositionsProperty->NextSampleIndex);
+
+		// only a block of full precision samples is alive at any time
+		const int32 BlockSize = FMath::Max(KeyframeInterval, 1);
+		TArray<FCurvesSample> BlockSamples;
+		TArray<bool> Results;
+		for (int32 FirstSampleIndex = 0; FirstSampleIndex < NumSamples; FirstSampleIndex += BlockSize)
+		{
+			const int32 NumBlockSamples = FMath::Min(BlockSize, NumSamples - FirstSampleIndex);
+			BlockSamples.Reset();
+			BlockSamples.SetNum(NumBlockSamples);
+			Results.Init(false, NumBlockSamples);
+
+			ParallelFor(NumBlockSamples, [&](const int32 BlockSampleIndex)
+				{
+					Results[BlockSampleIndex] = ReadCurvesSample(Object, FirstSampleIndex + BlockSampleIndex, BlockSamples[BlockSampleIndex]);
+				});
+
+			if (Results.Contains(false) || !AddBlock(BlockSamples))
+			{
+				return false;
+			}
+		}
+
+		return Frames.Num() > 0;
+	}
+
+	bool FCompressedCurvesStore::AddBlock(const TArrayView<const FCurvesSample> BlockSamples)
+	{
+		if (BlockSamples.Num() == 0)
+		{
+			return false;
+		}
+
+		if (!bHasLayout)
+		{
+			Offsets = BlockSamples[0].Offsets;
+			NumVertices = BlockSamples[0].Positions.Num();
+			bHasLayout = true;
+		}
+
+		FBox3f Bounds(ForceInit);
+		for (const FCurvesSample& Sample : BlockSamples)
+		{
+			if (Sample.Positions.Num() != NumVertices || Sample.Offsets != Offsets)
+			{
+				return false;
+			}
+
+			for (const FVector3f& Position : Sample.Positions)
+			{
+				Bounds += Position;
+			}
+		}
+
+		FBlock& Block = Blocks.AddDefaulted_GetRef();
+		Block.FirstFrameIndex = Frames.Num();
+		if (Bounds.IsValid)
+		{
+			Block.Min = Bounds.Min;
+			Block.Scale = (Bounds.Max - Bounds.Min) / MAX_uint16;
+		}
+
+		const FVector3f InvScale(Block.Scale.X > 0 ? 1.0f / Block.Scale.X : 0, Block.Scale.Y > 0 ? 1.0f / Block.Scale.Y : 0, Block.Scale.Z > 0 ? 1.0f / Block.Scale.Z : 0);
+
+		TArray<uint16> PreviousValues;
+		TArray<uint16> Values;
+		for (int32 BlockSampleIndex = 0; BlockSampleIndex < BlockSamples.Num(); BlockSampleIndex++)
+		{
+			// planar channels, as in the mesh frames
+			const TArray<FVector3f>& Positions = BlockSamples[BlockSampleIndex].Positions;
+			Values.SetNumUninitialized(NumVertices * 3, EAllowShrinking::No);
+			ParallelFor(NumVertices, [&](const int32 VertexIndex)
+				{
+					const FVector3f Position = (Positions[VertexIndex] - Block.Min) * InvScale;
+					Values[VertexIndex] = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt32(Position.X), 0, static_cast<int32>(MAX_uint16)));
+					Values[NumVertices + VertexIndex] = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt32(Position.Y), 0, static_cast<int32>(MAX_uint16)));
+					Values[NumVertices * 2 + VertexIndex] = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt32(Position.Z), 0, static_cast<int32>(MAX_uint16)));
+				});
+
+			FFrame& Frame = Frames.AddDefaulted_GetRef();
+			Frame.BlockIndex = Blocks.Num() - 1;
+			Frame.bKeyframe = BlockSampleIndex == 0;
+			if (Frame.bKeyframe)
+			{
+				Frame.Data.Append(reinterpret_cast<const uint8*>(Values.GetData()), Values.Num() * sizeof(uint16));
+			}
+			else
+			{
+				FrameStore::EncodeDeltas(Values, PreviousValues, Frame.Data);
+			}
+
+			Swap(Values, PreviousValues);
+		}
+
+		return true;
+	}
+
+	bool FCompressedCurvesStore::DecodeFrame(const int32 FrameIndex, TArray<FVector3f>& Positions) const
+	{
+		SCOPE_CYCLE_COUNTER(STAT_glTFRuntimeAlembic_FrameStoreDecode);
+
+		if (!Frames.IsValidIndex(FrameIndex))
+		{
+			return false;
+		}
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		const FBlock& Block = Blocks[Frames[FrameIndex].BlockIndex];
+		const FFrame& Keyframe = Frames[Block.FirstFrameIndex];
+		if (Keyframe.Data.Num() != NumVertices * 3 * static_cast<int32>(sizeof(uint16)))
+		{
+			return false;
+		}
+
+		TArray<uint16> Values;
+		Values.SetNumUninitialized(NumVertices * 3);
+		FMemory::Memcpy(Values.GetData(), Keyframe.Data.GetData(), Keyframe.Data.Num());
+
+		for (int32 DeltaFrameIndex = Block.FirstFrameIndex + 1; DeltaFrameIndex <= FrameIndex; DeltaFrameIndex++)
+		{
+			if (!FrameStore::DecodeDeltas(Frames[DeltaFrameIndex].Data, Values))
+			{
+				return false;
+			}
+		}
+
+		Positions.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+		ParallelFor(NumVertices, [&](const int32 VertexIndex)
+			{
+				Positions[VertexIndex] = Block.Min + FVector3f(static_cast<float>(Values[VertexIndex]), static_cast<float>(Values[NumVertices + VertexIndex]), static_cast<float>(Values[NumVertices * 2 + VertexIndex])) * Block.Scale;
+			});
+
+		DecodeCycles += FPlatformTime::Cycles64() - StartCycles;
+		DecodedBytes += static_cast<int64>(NumVertices) * sizeof(FVector3f);
+
+		return true;
+	}
+
+	int64 FCompressedCurvesStore::GetCompressedSize() const
+	{
+		int64 Size = Blocks.Num() * sizeof(FBlock) + Offsets.Num() * sizeof(int32);
+		for (const FFrame& Frame : Frames)
+		{
+			Size += Frame.Data.Num();
+		}
+		return Size;
+	}
+
+	int64 FCompressedCurvesStore::GetUncompressedSize() const
+	{
+		return static_cast<int64>(Frames.Num()) * NumVertices * sizeof(FVector3f);
+	}
+
+	float FCompressedCurvesStore::GetCompressionRatio() const
+	{
+		const int64 CompressedSize = GetCompressedSize();
+		return CompressedSize > 0 ? static_cast<float>(static_cast<double>(GetUncompressedSize()) / CompressedSize) : 0;
+	}
+
+	double FCompressedCurvesStore::GetDecodeThroughput() const
+	{
+		const double Seconds = FPlatformTime::ToSeconds64(DecodeCycles);
+		return Seconds > 0 ? (DecodedBytes / Seconds) / (1024 * 1024) : 0;
+	}
+}
\ No newline at end of file
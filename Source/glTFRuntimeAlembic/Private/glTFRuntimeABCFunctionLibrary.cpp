@@ -1,13 +1,27 @@
 // Copyright 2025 - Roberto De Ioris
 
 #include "glTFRuntimeABCFunctionLibrary.h"
-#include "CompGeom/PolygonTriangulation.h"
+#include "glTFRuntimeAlembicStats.h"
+#include "glTFRuntimeABCXform.h"
+#include "glTFRuntimeABCCurves.h"
+#include "glTFRuntimeAlembicGroomCacheComponent.h"
+#include "Async/ParallelFor.h"
+#include "glTFRuntimeGeomCacheFuncLibrary.h"
+#include "glTFRuntimeGeometryCacheTrack.h"
 #include "GroomAsset.h"
 #include "GroomBuilder.h"
+#include "GroomCache.h"
 #include "Components/SplineComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Animation/AnimSequence.h"
 
-bool UglTFRuntimeABCFunctionLibrary::LoadAlembicObjectAsRuntimeLOD(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const int32 SampleIndex, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig)
+bool UglTFRuntimeABCFunctionLibrary::LoadAlembicObjectAsRuntimeLOD(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const int32 SampleIndex, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig)
 {
+	if (!Asset)
+	{
+		return false;
+	}
+
 	TSharedPtr<glTFRuntimeAlembic::FObject> Root = glTFRuntimeAlembic::ParseArchive(Asset->GetParser()->GetBlob());
 	if (!Root)
 	{
@@ -20,9 +34,78 @@ bool UglTFRuntimeABCFunctionLibrary::LoadAlembicObjectAsRuntimeLOD(UglTFRuntimeA
 		return false;
 	}
 
+	return LoadRuntimeLODFromAlembicObject(Asset, *Object, SampleIndex, RuntimeLOD, StaticMeshMaterialsConfig, AlembicConfig);
+}
+
+bool UglTFRuntimeABCFunctionLibrary::LoadAlembicObjectAsRuntimeLODAtTime(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const float Time, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, const float FramesPerSecond)
+{
+	if (!Asset || Time < 0 || FramesPerSecond <= 0)
+	{
+		return false;
+	}
+
+	TSharedPtr<glTFRuntimeAlembic::FObject> Root = glTFRuntimeAlembic::ParseArchive(Asset->GetParser()->GetBlob());
+	if (!Root)
+	{
+		return false;
+	}
+
+	TSharedPtr<const glTFRuntimeAlembic::FObject> Object = Root->Find(ObjectPath);
+	if (!Object)
+	{
+		return false;
+	}
+
+	const float SampleTime = Time * FramesPerSecond;
+	const int32 SampleIndex = FMath::FloorToInt32(SampleTime);
+
+	return LoadRuntimeLODFromAlembicObject(Asset, *Object, SampleIndex, RuntimeLOD, StaticMeshMaterialsConfig, AlembicConfig, nullptr, nullptr, SampleTime - SampleIndex, 1.0f / FramesPerSecond);
+}
+
+bool UglTFRuntimeABCFunctionLibrary::LoadAlembicObjectAsRuntimeLODs(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const int32 SampleIndex, TArray<FglTFRuntimeMeshLOD>& RuntimeLODs, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig)
+{
+	if (!Asset)
+	{
+		return false;
+	}
+
+	TSharedPtr<glTFRuntimeAlembic::FObject> Root = glTFRuntimeAlembic::ParseArchive(Asset->GetParser()->GetBlob());
+	if (!Root)
+	{
+		return false;
+	}
+
+	TSharedPtr<const glTFRuntimeAlembic::FObject> Object = Root->Find(ObjectPath);
+	if (!Object)
+	{
+		return false;
+	}
+
+	RuntimeLODs.Empty();
+
+	FglTFRuntimeMeshLOD RuntimeLOD;
+	TArray<FglTFRuntimeMeshLOD> SimplifiedLODs;
+	if (!LoadRuntimeLODFromAlembicObject(Asset, *Object, SampleIndex, RuntimeLOD, StaticMeshMaterialsConfig, AlembicConfig, nullptr, &SimplifiedLODs))
+	{
+		return false;
+	}
+
+	RuntimeLODs.Add(MoveTemp(RuntimeLOD));
+	RuntimeLODs.Append(MoveTemp(SimplifiedLODs));
+
+	return true;
+}
+
+bool UglTFRuntimeABCFunctionLibrary::LoadRuntimeLODFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, const int32 SampleIndex, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, glTFRuntimeAlembic::FMeshTopologyCache* TopologyCache, TArray<FglTFRuntimeMeshLOD>* SimplifiedLODs, const float SampleAlpha, const float SampleDuration)
+{
+	if (!Asset)
+	{
+		return false;
+	}
+
 	FglTFRuntimePrimitive Primitive;
 
-	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> PositionsProperty = Object->FindArrayProperty(".geom/P");
+	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> PositionsProperty = Object.FindArrayProperty(".geom/P");
 	if (!PositionsProperty)
 	{
 		return false;
@@ -39,155 +122,908 @@ bool UglTFRuntimeABCFunctionLibrary::LoadAlembicObjectAsRuntimeLOD(UglTFRuntimeA
 		return false;
 	}
 
-	for (FVector& Position : Primitive.Positions)
+	// interpolated positions do not match any sample, so tangents cannot be cached
+	const bool bInterpolated = glTFRuntimeAlembic::InterpolatePositions(Object, SampleIndex, SampleAlpha, SampleDuration, Primitive.Positions);
+
+	ParallelFor(Primitive.Positions.Num(), [&](const int32 PositionIndex)
+		{
+			Primitive.Positions[PositionIndex] = Asset->GetParser()->TransformPosition(Primitive.Positions[PositionIndex]);
+		});
+
+	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> FaceIndicesProperty = Object.FindArrayProperty(".geom/.faceIndices");
+	if (!FaceIndicesProperty)
+	{
+		return false;
+	}
+
+	uint32 FaceIndicesPropertyTrueSampleIndex;
+	if (!FaceIndicesProperty->GetSampleTrueIndex(SampleIndex, FaceIndicesPropertyTrueSampleIndex))
+	{
+		return false;
+	}
+
+	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> FaceCountsProperty = Object.FindArrayProperty(".geom/.faceCounts");
+	if (!FaceCountsProperty)
+	{
+		return false;
+	}
+
+	uint32 FaceCountsPropertyTrueSampleIndex;
+	if (!FaceCountsProperty->GetSampleTrueIndex(SampleIndex, FaceCountsPropertyTrueSampleIndex))
+	{
+		return false;
+	}
+
+	glTFRuntimeAlembic::FGeomParamSample UVs;
+	const bool bHasUVs = glTFRuntimeAlembic::ReadGeomParam(Object, ".geom/uv", SampleIndex, UVs) && UVs.Extent == 2;
+
+	TArray<glTFRuntimeAlembic::FFaceSet> FaceSets;
+	if (!glTFRuntimeAlembic::ReadFaceSets(Object, SampleIndex, FaceSets))
+	{
+		return false;
+	}
+
+	TSharedPtr<const glTFRuntimeAlembic::FMeshTopology> Topology = nullptr;
+	{
+		const uint64 UVsKey = glTFRuntimeAlembic::FMeshTopology::GetUVsKey(bHasUVs ? &UVs : nullptr);
+		const uint64 FaceSetsKey = glTFRuntimeAlembic::FMeshTopology::GetFaceSetsKey(&FaceSets);
+
+		TArray<float> TriangleRatios;
+		if (SimplifiedLODs)
+		{
+			for (const FglTFRuntimeAlembicLODConfig& LODConfig : AlembicConfig.LODs)
+			{
+				TriangleRatios.Add(LODConfig.GetTriangleRatio());
+			}
+		}
+		const uint32 LODsKey = glTFRuntimeAlembic::FMeshTopology::GetLODsKey(TriangleRatios);
+
+		TOptional<FScopeLock> TopologyCacheLock;
+		if (TopologyCache)
+		{
+			TopologyCacheLock.Emplace(&TopologyCache->Lock);
+		}
+
+		if (TopologyCache && TopologyCache->Topology && TopologyCache->Topology->Matches(FaceIndicesPropertyTrueSampleIndex, FaceCountsPropertyTrueSampleIndex, Primitive.Positions.Num(), UVsKey, FaceSetsKey, AlembicConfig.bOptimizeVertexCache, LODsKey))
+		{
+			Topology = TopologyCache->Topology;
+		}
+		else
+		{
+			TSharedPtr<glTFRuntimeAlembic::FMeshTopology> NewTopology = glTFRuntimeAlembic::BuildMeshTopology(FaceIndicesProperty.ToSharedRef(), FaceIndicesPropertyTrueSampleIndex, FaceCountsProperty.ToSharedRef(), FaceCountsPropertyTrueSampleIndex, Primitive.Positions, bHasUVs ? &UVs : nullptr, &FaceSets);
+			if (!NewTopology)
+			{
+				return false;
+			}
+
+			if (AlembicConfig.bOptimizeVertexCache)
+			{
+				SCOPE_CYCLE_COUNTER(STAT_glTFRuntimeAlembic_VertexCacheOptimization);
+				glTFRuntimeAlembic::OptimizeMeshTopology(*NewTopology);
+			}
+
+			if (TriangleRatios.Num() > 0)
+			{
+				SCOPE_CYCLE_COUNTER(STAT_glTFRuntimeAlembic_MeshSimplification);
+				if (!glTFRuntimeAlembic::BuildMeshLODs(*NewTopology, Primitive.Positions, TriangleRatios))
+				{
+					UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to simplify %s"), *Object.Path);
+				}
+				NewTopology->LODsKey = LODsKey;
+			}
+
+			Topology = NewTopology;
+
+			if (TopologyCache)
+			{
+				TopologyCache->Topology = Topology;
+				TopologyCache->LODsTangents.Empty();
+			}
+		}
+	}
+
+	uint32 NormalsPropertyTrueSampleIndex = MAX_uint32;
+	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> NormalsProperty = Object.FindArrayProperty(".geom/N");
+	if (NormalsProperty)
+	{
+		if (!NormalsProperty->GetSampleTrueIndex(SampleIndex, NormalsPropertyTrueSampleIndex))
+		{
+			return false;
+		}
+
+		TArray<FVector> Normals;
+		if (!NormalsProperty->Get(NormalsPropertyTrueSampleIndex, Normals))
+		{
+			return false;
+		}
+
+		ParallelFor(Normals.Num(), [&](const int32 NormalIndex)
+			{
+				Normals[NormalIndex] = Asset->GetParser()->TransformVector(Normals[NormalIndex]);
+			});
+
+		glTFRuntimeAlembic::ComputeFaceVaryingNormals(*Topology, Normals, Primitive.Normals, Primitive.Tangents);
+
+		RuntimeLOD.bHasNormals = true;
+	}
+	else
+	{
+		glTFRuntimeAlembic::ComputeSmoothNormals(*Topology, Primitive.Positions, AlembicConfig.NormalsWeighting, Primitive.Normals, Primitive.Tangents);
+	}
+
+	// expand per-position attributes to the vertices split on UV seams
+	if (Topology->HasSplitVertices())
+	{
+		const int32 NumVertices = Topology->NumVertices();
+
+		TArray<FVector> Positions;
+		TArray<FVector> Normals;
+		TArray<FVector4> Tangents;
+		TArray<FVector2D> VerticesUVs;
+		Positions.AddUninitialized(NumVertices);
+		Normals.AddUninitialized(NumVertices);
+		Tangents.AddUninitialized(NumVertices);
+		VerticesUVs.AddUninitialized(NumVertices);
+
+		ParallelFor(NumVertices, [&](const int32 VertexIndex)
+			{
+				const uint32 PositionIndex = Topology->VertexPositions[VertexIndex];
+				const uint32 UVIndex = Topology->VertexUVs[VertexIndex];
+				Positions[VertexIndex] = Primitive.Positions[PositionIndex];
+				Normals[VertexIndex] = Primitive.Normals[PositionIndex];
+				Tangents[VertexIndex] = Primitive.Tangents[PositionIndex];
+				VerticesUVs[VertexIndex] = FVector2D(UVs.Values[UVIndex * 2], 1 - UVs.Values[UVIndex * 2 + 1]);
+			});
+
+		Primitive.Positions = MoveTemp(Positions);
+		Primitive.Normals = MoveTemp(Normals);
+		Primitive.Tangents = MoveTemp(Tangents);
+		Primitive.UVs.Add(MoveTemp(VerticesUVs));
+	}
+
+	if (Topology->Sections.Num() > 0)
+	{
+		AddSectionsPrimitives(RuntimeLOD, Topology->Sections, Primitive, StaticMeshMaterialsConfig);
+	}
+	else
+	{
+		Primitive.Indices = Topology->GetVertexIndices();
+
+		RuntimeLOD.Primitives.Add(MoveTemp(Primitive));
+	}
+
+	if (AlembicConfig.bGenerateMikkTSpaceTangents && bHasUVs)
+	{
+		GenerateMikkTSpaceTangents(RuntimeLOD, PositionsPropertyTrueSampleIndex, NormalsPropertyTrueSampleIndex, bInterpolated ? nullptr : TopologyCache);
+	}
+
+	// simplified LODs reuse the LOD 0 vertex attributes, only their index buffers differ
+	if (SimplifiedLODs)
+	{
+		for (int32 LODIndex = 0; LODIndex < Topology->LODSections.Num(); LODIndex++)
+		{
+			FglTFRuntimeMeshLOD& SimplifiedLOD = SimplifiedLODs->AddDefaulted_GetRef();
+			SimplifiedLOD.bHasNormals = RuntimeLOD.bHasNormals;
+			AddSectionsPrimitives(SimplifiedLOD, Topology->LODSections[LODIndex], Primitive, StaticMeshMaterialsConfig);
+			if (AlembicConfig.bGenerateMikkTSpaceTangents && bHasUVs)
+			{
+				GenerateMikkTSpaceTangents(SimplifiedLOD, PositionsPropertyTrueSampleIndex, NormalsPropertyTrueSampleIndex, bInterpolated ? nullptr : TopologyCache, LODIndex + 1);
+			}
+		}
+	}
+
+	return true;
+}
+
+void UglTFRuntimeABCFunctionLibrary::AddSectionsPrimitives(FglTFRuntimeMeshLOD& RuntimeLOD, const TArray<glTFRuntimeAlembic::FMeshSection>& Sections, const FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig)
+{
+	// one primitive (and material) per face set, each one only gets the vertices it references
+	const int32 FirstPrimitiveIndex = RuntimeLOD.Primitives.Num();
+	RuntimeLOD.Primitives.AddDefaulted(Sections.Num());
+
+	ParallelFor(Sections.Num(), [&](const int32 SectionIndex)
+		{
+			const glTFRuntimeAlembic::FMeshSection& Section = Sections[SectionIndex];
+			FglTFRuntimePrimitive& SectionPrimitive = RuntimeLOD.Primitives[FirstPrimitiveIndex + SectionIndex];
+
+			SectionPrimitive.Positions.AddUninitialized(Section.Vertices.Num());
+			SectionPrimitive.Normals.AddUninitialized(Section.Vertices.Num());
+			SectionPrimitive.Tangents.AddUninitialized(Section.Vertices.Num());
+			SectionPrimitive.UVs.SetNum(Primitive.UVs.Num());
+			for (TArray<FVector2D>& SectionUVs : SectionPrimitive.UVs)
+			{
+				SectionUVs.AddUninitialized(Section.Vertices.Num());
+			}
+
+			for (int32 VertexIndex = 0; VertexIndex < Section.Vertices.Num(); VertexIndex++)
+			{
+				const uint32 SourceVertexIndex = Section.Vertices[VertexIndex];
+				SectionPrimitive.Positions[VertexIndex] = Primitive.Positions[SourceVertexIndex];
+				SectionPrimitive.Normals[VertexIndex] = Primitive.Normals[SourceVertexIndex];
+				SectionPrimitive.Tangents[VertexIndex] = Primitive.Tangents[SourceVertexIndex];
+				for (int32 UVIndex = 0; UVIndex < Primitive.UVs.Num(); UVIndex++)
+				{
+					SectionPrimitive.UVs[UVIndex][VertexIndex] = Primitive.UVs[UVIndex][SourceVertexIndex];
+				}
+			}
+
+			SectionPrimitive.Indices = Section.Indices;
+			SectionPrimitive.MaterialName = Section.Name;
+		});
+
+	// materials are resolved on the calling thread
+	for (int32 SectionIndex = 0; SectionIndex < Sections.Num(); SectionIndex++)
+	{
+		const glTFRuntimeAlembic::FMeshSection& Section = Sections[SectionIndex];
+		FglTFRuntimePrimitive& SectionPrimitive = RuntimeLOD.Primitives[FirstPrimitiveIndex + SectionIndex];
+
+		if (UMaterialInterface* const* MaterialByName = StaticMeshMaterialsConfig.MaterialsOverrideByNameMap.Find(Section.Name))
+		{
+			SectionPrimitive.Material = *MaterialByName;
+		}
+		else if (UMaterialInterface* const* MaterialByIndex = StaticMeshMaterialsConfig.MaterialsOverrideMap.Find(Section.FaceSetIndex))
+		{
+			SectionPrimitive.Material = *MaterialByIndex;
+		}
+	}
+}
+
+UGeometryCache* UglTFRuntimeABCFunctionLibrary::LoadAlembicObjectAsGeometryCache(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig)
+{
+	if (!Asset)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<glTFRuntimeAlembic::FObject> Root = glTFRuntimeAlembic::ParseArchive(Asset->GetParser()->GetBlob());
+	if (!Root)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<const glTFRuntimeAlembic::FObject> Object = Root->Find(ObjectPath);
+	if (!Object)
+	{
+		return nullptr;
+	}
+
+	return LoadGeometryCacheFromAlembicObject(Asset, *Object, StaticMeshMaterialsConfig, AlembicConfig);
+}
+
+UGeometryCache* UglTFRuntimeABCFunctionLibrary::LoadGeometryCacheFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig)
+{
+	TArray<FglTFRuntimeGeometryCacheFrame> Frames;
+	if (!LoadGeometryCacheFramesFromAlembicObject(Asset, Object, Frames, StaticMeshMaterialsConfig, AlembicConfig))
+	{
+		return nullptr;
+	}
+
+	return LoadGeometryCacheFromFrames(Frames);
+}
+
+UGeometryCache* UglTFRuntimeABCFunctionLibrary::LoadGeometryCacheFromFrames(const TArray<FglTFRuntimeGeometryCacheFrame>& Frames)
+{
+	UglTFRuntimeGeometryCacheTrack* Track = UglTFRuntimeGeomCacheFuncLibrary::LoadRuntimeTrackFromGeometryCacheFrames(Frames);
+	if (!Track)
+	{
+		return nullptr;
+	}
+
+	return UglTFRuntimeGeomCacheFuncLibrary::LoadGeometryCacheFromRuntimeTracks({ Track });
+}
+
+bool UglTFRuntimeABCFunctionLibrary::LoadGeometryCacheFramesFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, TArray<FglTFRuntimeGeometryCacheFrame>& Frames, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig)
+{
+	Frames.Empty();
+
+	// retrieve the number of samples from .geom/P
+	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> PositionsProperty = Object.FindArrayProperty(".geom/P");
+	if (!PositionsProperty || PositionsProperty->NextSampleIndex == 0)
+	{
+		return false;
+	}
+
+	const int32 NumSamples = PositionsProperty->NextSampleIndex;
+	const int32 FirstSampleIndex = FMath::Clamp(AlembicConfig.FirstSampleIndex, 0, NumSamples - 1);
+	const int32 LastSampleIndex = AlembicConfig.LastSampleIndex < 0 ? NumSamples - 1 : FMath::Clamp(AlembicConfig.LastSampleIndex, FirstSampleIndex, NumSamples - 1);
+	const int32 SampleStride = FMath::Max(AlembicConfig.SampleStride, 1);
+	const int32 NumFrames = (LastSampleIndex - FirstSampleIndex) / SampleStride + 1;
+
+	// triangulation and adjacency are shared by all the frames with the same topology
+	glTFRuntimeAlembic::FMeshTopologyCache TopologyCache;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_glTFRuntimeAlembic_GeometryCacheBake);
+
+		// geometry cache tracks hold a frame until the next one, so with decimation only the frames matching the last kept one within the error bound are dropped
+		const bool bDecimateFrames = AlembicConfig.FrameDecimationMaxError > 0;
+		int32 NumDroppedFrames = 0;
+		auto AddFrame = [&](FglTFRuntimeGeometryCacheFrame&& Frame, const bool bLastFrame)
+			{
+				// the last frame is always kept to preserve the duration
+				if (bDecimateFrames && Frames.Num() > 0 && !bLastFrame && NumDroppedFrames < AlembicConfig.FrameDecimationMaxSpan)
+				{
+					const FglTFRuntimeMeshLOD& Keyframe = Frames.Last().Mesh;
+					if (IsRuntimeLODInterpolationWithinError(Keyframe, Keyframe, Frame.Mesh, 0, AlembicConfig.FrameDecimationMaxError))
+					{
+						NumDroppedFrames++;
+						return;
+					}
+				}
+
+				NumDroppedFrames = 0;
+				Frames.Add(MoveTemp(Frame));
+			};
+
+		// frames are decoded in batches of FramesInFlight to bound the decoding temporaries
+		const int32 FramesInFlight = AlembicConfig.MaxFramesInFlight > 0 ? AlembicConfig.MaxFramesInFlight : FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+		TArray<FglTFRuntimeGeometryCacheFrame> BatchFrames;
+		for (int32 FirstFrameIndex = 0; FirstFrameIndex < NumFrames; FirstFrameIndex += FramesInFlight)
+		{
+			const int32 NumBatchFrames = FMath::Min<int32>(FramesInFlight, NumFrames - FirstFrameIndex);
+			BatchFrames.Reset();
+			BatchFrames.AddDefaulted(NumBatchFrames);
+			ParallelFor(NumBatchFrames, [&](const int32 BatchFrameIndex)
+				{
+					const int32 FrameIndex = FirstFrameIndex + BatchFrameIndex;
+					const int32 SampleIndex = FirstSampleIndex + FrameIndex * SampleStride;
+					// the cache starts at the first baked sample, strides keep the original timing
+					BatchFrames[BatchFrameIndex].Time = (1.0 / 24) * (SampleIndex - FirstSampleIndex);
+					if (!LoadRuntimeLODFromAlembicObject(Asset, Object, SampleIndex, BatchFrames[BatchFrameIndex].Mesh, StaticMeshMaterialsConfig, AlembicConfig, &TopologyCache))
+					{
+						UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to load sample %d from %s"), SampleIndex, *Object.Path);
+					}
+				}, FramesInFlight > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+			for (int32 BatchFrameIndex = 0; BatchFrameIndex < NumBatchFrames; BatchFrameIndex++)
+			{
+				AddFrame(MoveTemp(BatchFrames[BatchFrameIndex]), FirstFrameIndex + BatchFrameIndex == NumFrames - 1);
+			}
+		}
+
+		if (bDecimateFrames)
+		{
+			UE_LOG(LogGLTFRuntime, Log, TEXT("Kept %d of %d samples of %s"), Frames.Num(), NumFrames, *Object.Path);
+		}
+	}
+
+	return Frames.Num() > 0;
+}
+
+bool UglTFRuntimeABCFunctionLibrary::LoadAlembicObjectAsMergedRuntimeLODs(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const int32 SampleIndex, TArray<FglTFRuntimeMeshLOD>& ChunksRuntimeLODs, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, const float ChunkSize)
+{
+	if (!Asset)
+	{
+		return false;
+	}
+
+	TSharedPtr<glTFRuntimeAlembic::FObject> Root = glTFRuntimeAlembic::ParseArchive(Asset->GetParser()->GetBlob());
+	if (!Root)
+	{
+		return false;
+	}
+
+	TSharedPtr<const glTFRuntimeAlembic::FObject> Object = Root->Find(ObjectPath);
+	if (!Object)
+	{
+		return false;
+	}
+
+	return LoadMergedRuntimeLODsFromAlembicObject(Asset, *Object, SampleIndex, ChunksRuntimeLODs, StaticMeshMaterialsConfig, AlembicConfig, ChunkSize);
+}
+
+bool UglTFRuntimeABCFunctionLibrary::LoadMergedRuntimeLODsFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, const int32 SampleIndex, TArray<FglTFRuntimeMeshLOD>& ChunksRuntimeLODs, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, const float ChunkSize)
+{
+	ChunksRuntimeLODs.Reset();
+
+	if (!Asset)
+	{
+		return false;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_glTFRuntimeAlembic_StaticMeshMerge);
+
+	glTFRuntimeAlembic::FXformHierarchy Hierarchy;
+	Hierarchy.Build(Object);
+
+	TArray<FMatrix> WorldMatrices;
+	if (!Hierarchy.EvaluateWorldMatrices(SampleIndex, WorldMatrices))
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to evaluate some of the xforms under %s"), *Object.Path);
+	}
+
+	// relative to the object, its own xform is applied by its component
+	const FMatrix InverseRootMatrix = WorldMatrices[0].Inverse();
+
+	// polymeshes hidden at SampleIndex are not merged
+	TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FVisibilityTrack> VisibilityTracks;
+	glTFRuntimeAlembic::BakeVisibilityTracks(Object, VisibilityTracks);
+
+	TArray<int32> PolyMeshes;
+	for (int32 ObjectIndex = 0; ObjectIndex < Hierarchy.Num(); ObjectIndex++)
+	{
+		const glTFRuntimeAlembic::FVisibilityTrack* VisibilityTrack = VisibilityTracks.Find(Hierarchy.Objects[ObjectIndex]);
+		if (Hierarchy.Objects[ObjectIndex]->GetSchema() == "AbcGeom_PolyMesh_v1" && (!VisibilityTrack || VisibilityTrack->IsVisible(SampleIndex)))
+		{
+			PolyMeshes.Add(ObjectIndex);
+		}
+	}
+
+	TArray<FglTFRuntimeMeshLOD> MeshesLODs;
+	TArray<FIntVector> MeshesChunks;
+	TArray<bool> Results;
+	MeshesLODs.SetNum(PolyMeshes.Num());
+	MeshesChunks.Init(FIntVector::ZeroValue, PolyMeshes.Num());
+	Results.Init(false, PolyMeshes.Num());
+	ParallelFor(PolyMeshes.Num(), [&](const int32 PolyMeshIndex)
+		{
+			const int32 ObjectIndex = PolyMeshes[PolyMeshIndex];
+			const glTFRuntimeAlembic::FObject& PolyMesh = *Hierarchy.Objects[ObjectIndex];
+			FglTFRuntimeMeshLOD& MeshLOD = MeshesLODs[PolyMeshIndex];
+
+			// static polymeshes only have sample 0
+			TSharedPtr<glTFRuntimeAlembic::FArrayProperty> PositionsProperty = PolyMesh.FindArrayProperty(".geom/P");
+			const int32 MeshSampleIndex = PositionsProperty ? FMath::Clamp<int32>(SampleIndex, 0, PositionsProperty->NextSampleIndex - 1) : 0;
+			if (!LoadRuntimeLODFromAlembicObject(Asset, PolyMesh, MeshSampleIndex, MeshLOD, StaticMeshMaterialsConfig, AlembicConfig))
+			{
+				UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to load sample %d from %s"), MeshSampleIndex, *PolyMesh.Path);
+				return;
+			}
+
+			TransformRuntimeLOD(MeshLOD, Asset->GetParser()->TransformTransform(FTransform(WorldMatrices[ObjectIndex] * InverseRootMatrix)));
+
+			if (ChunkSize > 0)
+			{
+				FBox Bounds(ForceInit);
+				for (const FglTFRuntimePrimitive& Primitive : MeshLOD.Primitives)
+				{
+					Bounds += FBox(Primitive.Positions);
+				}
+				const FVector Cell = Bounds.GetCenter() / ChunkSize;
+				MeshesChunks[PolyMeshIndex] = FIntVector(FMath::FloorToInt32(Cell.X), FMath::FloorToInt32(Cell.Y), FMath::FloorToInt32(Cell.Z));
+			}
+
+			Results[PolyMeshIndex] = true;
+		});
+
+	TMap<FIntVector, int32> ChunksIndices;
+	for (int32 PolyMeshIndex = 0; PolyMeshIndex < PolyMeshes.Num(); PolyMeshIndex++)
+	{
+		if (!Results[PolyMeshIndex])
+		{
+			continue;
+		}
+
+		int32 ChunkIndex;
+		if (const int32* ExistingChunkIndex = ChunksIndices.Find(MeshesChunks[PolyMeshIndex]))
+		{
+			ChunkIndex = *ExistingChunkIndex;
+		}
+		else
+		{
+			ChunkIndex = ChunksRuntimeLODs.AddDefaulted();
+			ChunksRuntimeLODs[ChunkIndex].bHasNormals = true;
+			ChunksRuntimeLODs[ChunkIndex].bHasTangents = true;
+			ChunksIndices.Add(MeshesChunks[PolyMeshIndex], ChunkIndex);
+		}
+
+		FglTFRuntimeMeshLOD& ChunkRuntimeLOD = ChunksRuntimeLODs[ChunkIndex];
+		ChunkRuntimeLOD.Primitives.Append(MoveTemp(MeshesLODs[PolyMeshIndex].Primitives));
+		ChunkRuntimeLOD.bHasNormals &= MeshesLODs[PolyMeshIndex].bHasNormals;
+		ChunkRuntimeLOD.bHasTangents &= MeshesLODs[PolyMeshIndex].bHasTangents;
+	}
+
+	ParallelFor(ChunksRuntimeLODs.Num(), [&](const int32 ChunkIndex)
+		{
+			MergeRuntimeLODPrimitives(ChunksRuntimeLODs[ChunkIndex]);
+		});
+
+	return ChunksRuntimeLODs.Num() > 0;
+}
+
+USkeletalMesh* UglTFRuntimeABCFunctionLibrary::LoadAlembicObjectAsSkeletalMesh(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, UAnimSequence*& AnimSequence, const float FramesPerSecond)
+{
+	AnimSequence = nullptr;
+
+	if (!Asset)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<glTFRuntimeAlembic::FObject> Root = glTFRuntimeAlembic::ParseArchive(Asset->GetParser()->GetBlob());
+	if (!Root)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<const glTFRuntimeAlembic::FObject> Object = Root->Find(ObjectPath);
+	if (!Object)
+	{
+		return nullptr;
+	}
+
+	return LoadSkeletalMeshFromAlembicObject(Asset, *Object, SkeletalMeshConfig, AlembicConfig, &AnimSequence, FramesPerSecond);
+}
+
+USkeletalMesh* UglTFRuntimeABCFunctionLibrary::LoadSkeletalMeshFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, UAnimSequence** AnimSequence, const float FramesPerSecond)
+{
+	if (AnimSequence)
+	{
+		*AnimSequence = nullptr;
+	}
+
+	glTFRuntimeAlembic::FRigidSkeletalMesh RigidSkeletalMesh;
+	if (!LoadRigidSkeletalMeshFromAlembicObject(Asset, Object, SkeletalMeshConfig.MaterialsConfig, AlembicConfig, RigidSkeletalMesh, AnimSequence != nullptr, FramesPerSecond))
+	{
+		return nullptr;
+	}
+
+	return LoadSkeletalMeshFromRigidSkeletalMesh(Asset, RigidSkeletalMesh, SkeletalMeshConfig, AnimSequence);
+}
+
+bool UglTFRuntimeABCFunctionLibrary::LoadRigidSkeletalMeshFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, const FglTFRuntimeMaterialsConfig& SkeletalMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, glTFRuntimeAlembic::FRigidSkeletalMesh& RigidSkeletalMesh, const bool bBakeAnimation, const float FramesPerSecond)
+{
+	RigidSkeletalMesh = glTFRuntimeAlembic::FRigidSkeletalMesh();
+
+	if (!Asset)
+	{
+		return false;
+	}
+
+	glTFRuntimeAlembic::FRigidSkeleton RigidSkeleton;
+	if (!RigidSkeleton.Build(Object))
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("No polymeshes found under %s"), *Object.Path);
+		return false;
+	}
+
+	FglTFRuntimeMeshLOD& RuntimeLOD = RigidSkeletalMesh.RuntimeLOD;
+	TArray<glTFRuntimeAlembic::FXformTrack> Tracks;
+	int32 FirstSampleIndex = 0;
+	int32 LastSampleIndex = 0;
+	int32 SampleStride = 1;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_glTFRuntimeAlembic_SkeletalMeshBake);
+
+		// the root object may have no xform (its track stays empty and evaluates to the identity)
+		Tracks.SetNum(RigidSkeleton.Bones.Num());
+		ParallelFor(RigidSkeleton.Bones.Num(), [&](const int32 BoneIndex)
+			{
+				glTFRuntimeAlembic::BakeXformTrack(*RigidSkeleton.Bones[BoneIndex].Object, Tracks[BoneIndex]);
+			});
+
+		int32 NumSamples = 1;
+		for (const glTFRuntimeAlembic::FXformTrack& Track : Tracks)
+		{
+			NumSamples = FMath::Max(NumSamples, Track.NumSamples);
+		}
+		for (const glTFRuntimeAlembic::FXformTrack& Track : RigidSkeleton.AncestorsTracks)
+		{
+			NumSamples = FMath::Max(NumSamples, Track.NumSamples);
+		}
+
+		FirstSampleIndex = FMath::Clamp(AlembicConfig.FirstSampleIndex, 0, NumSamples - 1);
+		LastSampleIndex = AlembicConfig.LastSampleIndex < 0 ? NumSamples - 1 : FMath::Clamp(AlembicConfig.LastSampleIndex, FirstSampleIndex, NumSamples - 1);
+		SampleStride = FMath::Max(AlembicConfig.SampleStride, 1);
+
+		// the reference pose is the first baked sample
+		TArray<FTransform> ComponentTransforms;
+		ComponentTransforms.AddUninitialized(RigidSkeleton.Bones.Num());
+		for (int32 BoneIndex = 0; BoneIndex < RigidSkeleton.Bones.Num(); BoneIndex++)
+		{
+			const glTFRuntimeAlembic::FRigidSkeleton::FBone& RigidBone = RigidSkeleton.Bones[BoneIndex];
+
+			FglTFRuntimeBone& Bone = RuntimeLOD.Skeleton.AddDefaulted_GetRef();
+			Bone.BoneName = RigidBone.Name;
+			Bone.ParentIndex = RigidBone.ParentIndex;
+			Bone.Transform = Asset->GetParser()->TransformTransform(RigidSkeleton.GetBoneTransform(Tracks, BoneIndex, FirstSampleIndex));
+
+			ComponentTransforms[BoneIndex] = RigidBone.ParentIndex != INDEX_NONE ? Bone.Transform * ComponentTransforms[RigidBone.ParentIndex] : Bone.Transform;
+		}
+
+		// every polymesh is moved to its bind pose and fully weighted to its bone
+		TArray<FglTFRuntimeMeshLOD> MeshesLODs;
+		TArray<bool> Results;
+		MeshesLODs.SetNum(RigidSkeleton.Meshes.Num());
+		Results.Init(false, RigidSkeleton.Meshes.Num());
+		ParallelFor(RigidSkeleton.Meshes.Num(), [&](const int32 MeshIndex)
+			{
+				const glTFRuntimeAlembic::FRigidSkeleton::FRigidMesh& RigidMesh = RigidSkeleton.Meshes[MeshIndex];
+				FglTFRuntimeMeshLOD& MeshLOD = MeshesLODs[MeshIndex];
+
+				// static polymeshes only have sample 0
+				TSharedPtr<glTFRuntimeAlembic::FArrayProperty> PositionsProperty = RigidMesh.Object->FindArrayProperty(".geom/P");
+				const int32 MeshSampleIndex = PositionsProperty ? FMath::Clamp<int32>(FirstSampleIndex, 0, PositionsProperty->NextSampleIndex - 1) : 0;
+				if (!LoadRuntimeLODFromAlembicObject(Asset, *RigidMesh.Object, MeshSampleIndex, MeshLOD, SkeletalMeshMaterialsConfig, AlembicConfig))
+				{
+					UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to load sample %d from %s"), MeshSampleIndex, *RigidMesh.Object->Path);
+					return;
+				}
+
+				TransformRuntimeLOD(MeshLOD, ComponentTransforms[RigidMesh.BoneIndex]);
+
+				FglTFRuntimeUInt16Vector4 Joints;
+				Joints.X = RigidMesh.BoneIndex;
+				Joints.Y = 0;
+				Joints.Z = 0;
+				Joints.W = 0;
+				for (FglTFRuntimePrimitive& Primitive : MeshLOD.Primitives)
+				{
+					Primitive.Joints.AddDefaulted_GetRef().Init(Joints, Primitive.Positions.Num());
+					Primitive.Weights.AddDefaulted_GetRef().Init(FVector4(1, 0, 0, 0), Primitive.Positions.Num());
+				}
+
+				Results[MeshIndex] = true;
+			});
+
+		RuntimeLOD.bHasNormals = true;
+		RuntimeLOD.bHasTangents = true;
+		for (int32 MeshIndex = 0; MeshIndex < MeshesLODs.Num(); MeshIndex++)
+		{
+			if (Results[MeshIndex])
+			{
+				RuntimeLOD.Primitives.Append(MoveTemp(MeshesLODs[MeshIndex].Primitives));
+				RuntimeLOD.bHasNormals &= MeshesLODs[MeshIndex].bHasNormals;
+				RuntimeLOD.bHasTangents &= MeshesLODs[MeshIndex].bHasTangents;
+			}
+		}
+
+		if (RuntimeLOD.Primitives.Num() == 0)
+		{
+			return false;
+		}
+
+		MergeRuntimeLODPrimitives(RuntimeLOD);
+	}
+
+	if (!bBakeAnimation)
+	{
+		return true;
+	}
+
+	// only the animated bones get a track, the others keep the reference pose
+	const int32 NumKeys = (LastSampleIndex - FirstSampleIndex) / SampleStride + 1;
+	TMap<FString, FRawAnimSequenceTrack>& AnimTracks = RigidSkeletalMesh.AnimTracks;
+	for (int32 BoneIndex = 0; BoneIndex < RigidSkeleton.Bones.Num(); BoneIndex++)
+	{
+		if (!RigidSkeleton.IsBoneAnimated(Tracks, BoneIndex))
+		{
+			continue;
+		}
+
+		FRawAnimSequenceTrack& AnimTrack = AnimTracks.Add(RigidSkeleton.Bones[BoneIndex].Name);
+		AnimTrack.PosKeys.Reserve(NumKeys);
+		AnimTrack.RotKeys.Reserve(NumKeys);
+		AnimTrack.ScaleKeys.Reserve(NumKeys);
+		for (int32 KeyIndex = 0; KeyIndex < NumKeys; KeyIndex++)
+		{
+			const FTransform Transform = Asset->GetParser()->TransformTransform(RigidSkeleton.GetBoneTransform(Tracks, BoneIndex, FirstSampleIndex + KeyIndex * SampleStride));
+			AnimTrack.PosKeys.Add(FVector3f(Transform.GetTranslation()));
+			AnimTrack.RotKeys.Add(FQuat4f(Transform.GetRotation()));
+			AnimTrack.ScaleKeys.Add(FVector3f(Transform.GetScale3D()));
+		}
+	}
+
+	// strides keep the original timing
+	RigidSkeletalMesh.AnimDuration = FMath::Max(NumKeys - 1, 1) * SampleStride / FMath::Max(FramesPerSecond, UE_KINDA_SMALL_NUMBER);
+
+	return true;
+}
+
+USkeletalMesh* UglTFRuntimeABCFunctionLibrary::LoadSkeletalMeshFromRigidSkeletalMesh(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FRigidSkeletalMesh& RigidSkeletalMesh, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, UAnimSequence** AnimSequence)
+{
+	if (AnimSequence)
 	{
-		Position = Asset->GetParser()->TransformPosition(Position);
+		*AnimSequence = nullptr;
 	}
 
-	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> FaceIndicesProperty = Object->FindArrayProperty(".geom/.faceIndices");
-	if (!FaceIndicesProperty)
+	if (!Asset)
 	{
-		return false;
+		return nullptr;
 	}
 
-	uint32 FaceIndicesPropertyTrueSampleIndex;
-	if (!FaceIndicesProperty->GetSampleTrueIndex(SampleIndex, FaceIndicesPropertyTrueSampleIndex))
+	USkeletalMesh* SkeletalMesh = Asset->LoadSkeletalMeshFromRuntimeLODs({ RigidSkeletalMesh.RuntimeLOD }, INDEX_NONE, SkeletalMeshConfig);
+	if (!SkeletalMesh || !AnimSequence || RigidSkeletalMesh.AnimTracks.Num() == 0)
 	{
-		return false;
+		return SkeletalMesh;
 	}
 
-	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> FaceCountsProperty = Object->FindArrayProperty(".geom/.faceCounts");
-	if (!FaceCountsProperty)
+	TMap<FName, TArray<TPair<float, float>>> MorphTargetCurves;
+	*AnimSequence = Asset->LoadSkeletalAnimationFromTracksAndMorphTargets(SkeletalMesh, RigidSkeletalMesh.AnimTracks, MorphTargetCurves, RigidSkeletalMesh.AnimDuration, FglTFRuntimeSkeletalAnimationConfig());
+
+	return SkeletalMesh;
+}
+
+void UglTFRuntimeABCFunctionLibrary::TransformRuntimeLOD(FglTFRuntimeMeshLOD& RuntimeLOD, const FTransform& Transform)
+{
+	// normals follow the inverse transpose, to stay perpendicular under non uniform scales
+	const FMatrix Matrix = Transform.ToMatrixWithScale();
+	const FMatrix NormalsMatrix = Matrix.Inverse().GetTransposed();
+	// mirroring transforms flip the winding and the tangent basis handedness
+	const bool bMirrored = Matrix.Determinant() < 0;
+
+	ParallelFor(RuntimeLOD.Primitives.Num(), [&](const int32 PrimitiveIndex)
+		{
+			FglTFRuntimePrimitive& Primitive = RuntimeLOD.Primitives[PrimitiveIndex];
+			for (FVector& Position : Primitive.Positions)
+			{
+				Position = Transform.TransformPosition(Position);
+			}
+
+			for (FVector& Normal : Primitive.Normals)
+			{
+				Normal = NormalsMatrix.TransformVector(Normal).GetSafeNormal();
+			}
+
+			for (FVector4& Tangent : Primitive.Tangents)
+			{
+				const FVector TangentVector = Transform.TransformVector(FVector(Tangent.X, Tangent.Y, Tangent.Z)).GetSafeNormal();
+				Tangent = FVector4(TangentVector, bMirrored ? -Tangent.W : Tangent.W);
+			}
+
+			if (bMirrored)
+			{
+				for (int32 Index = 0; Index + 2 < Primitive.Indices.Num(); Index += 3)
+				{
+					Swap(Primitive.Indices[Index + 1], Primitive.Indices[Index + 2]);
+				}
+			}
+		});
+}
+
+void UglTFRuntimeABCFunctionLibrary::MergeRuntimeLODPrimitives(FglTFRuntimeMeshLOD& RuntimeLOD)
+{
+	auto HasSameLayout = [](const FglTFRuntimePrimitive& A, const FglTFRuntimePrimitive& B)
+		{
+			return A.Material == B.Material &&
+				A.MaterialName == B.MaterialName &&
+				A.UVs.Num() == B.UVs.Num() &&
+				A.Normals.IsEmpty() == B.Normals.IsEmpty() &&
+				A.Tangents.IsEmpty() == B.Tangents.IsEmpty() &&
+				A.Colors.IsEmpty() == B.Colors.IsEmpty() &&
+				A.Joints.Num() == B.Joints.Num() &&
+				A.Weights.Num() == B.Weights.Num();
+		};
+
+	TArray<FglTFRuntimePrimitive> Primitives;
+	for (FglTFRuntimePrimitive& Primitive : RuntimeLOD.Primitives)
 	{
-		return false;
+		FglTFRuntimePrimitive* Target = Primitives.FindByPredicate([&](const FglTFRuntimePrimitive& Candidate) { return HasSameLayout(Candidate, Primitive); });
+		if (!Target)
+		{
+			Primitives.Add(MoveTemp(Primitive));
+			continue;
+		}
+
+		const uint32 BaseVertexIndex = Target->Positions.Num();
+
+		Target->Positions.Append(Primitive.Positions);
+		Target->Normals.Append(Primitive.Normals);
+		Target->Tangents.Append(Primitive.Tangents);
+		Target->Colors.Append(Primitive.Colors);
+		for (int32 UVIndex = 0; UVIndex < Target->UVs.Num(); UVIndex++)
+		{
+			Target->UVs[UVIndex].Append(Primitive.UVs[UVIndex]);
+		}
+		for (int32 JointsIndex = 0; JointsIndex < Target->Joints.Num(); JointsIndex++)
+		{
+			Target->Joints[JointsIndex].Append(Primitive.Joints[JointsIndex]);
+		}
+		for (int32 WeightsIndex = 0; WeightsIndex < Target->Weights.Num(); WeightsIndex++)
+		{
+			Target->Weights[WeightsIndex].Append(Primitive.Weights[WeightsIndex]);
+		}
+
+		const int32 FirstIndex = Target->Indices.Num();
+		Target->Indices.AddUninitialized(Primitive.Indices.Num());
+		for (int32 Index = 0; Index < Primitive.Indices.Num(); Index++)
+		{
+			Target->Indices[FirstIndex + Index] = BaseVertexIndex + Primitive.Indices[Index];
+		}
 	}
 
-	uint32 FaceCountsPropertyTrueSampleIndex;
-	if (!FaceCountsProperty->GetSampleTrueIndex(SampleIndex, FaceCountsPropertyTrueSampleIndex))
+	RuntimeLOD.Primitives = MoveTemp(Primitives);
+}
+
+bool UglTFRuntimeABCFunctionLibrary::IsRuntimeLODInterpolationWithinError(const FglTFRuntimeMeshLOD& From, const FglTFRuntimeMeshLOD& To, const FglTFRuntimeMeshLOD& RuntimeLOD, const float Alpha, const float MaxError)
+{
+	if (From.Primitives.Num() != RuntimeLOD.Primitives.Num() || To.Primitives.Num() != RuntimeLOD.Primitives.Num())
 	{
 		return false;
 	}
 
-	TArray<FVector> Normals;
-	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> NormalsProperty = Object->FindArrayProperty(".geom/N");
-	if (NormalsProperty)
+	for (int32 PrimitiveIndex = 0; PrimitiveIndex < RuntimeLOD.Primitives.Num(); PrimitiveIndex++)
 	{
-		uint32 NormalsPropertyTrueSampleIndex;
-		if (!NormalsProperty->GetSampleTrueIndex(SampleIndex, NormalsPropertyTrueSampleIndex))
+		const FglTFRuntimePrimitive& Primitive = RuntimeLOD.Primitives[PrimitiveIndex];
+		if (From.Primitives[PrimitiveIndex].Indices != Primitive.Indices || To.Primitives[PrimitiveIndex].Indices != Primitive.Indices)
 		{
 			return false;
 		}
 
-		if (!NormalsProperty->Get(NormalsPropertyTrueSampleIndex, Normals))
+		if (!glTFRuntimeAlembic::IsInterpolationWithinError(From.Primitives[PrimitiveIndex].Positions, To.Primitives[PrimitiveIndex].Positions, Primitive.Positions, Alpha, MaxError))
 		{
 			return false;
 		}
-
-		RuntimeLOD.bHasNormals = true;
 	}
 
-	auto ComputeTangent = [](const FVector& Normal)
-		{
-			FVector Arbitrary = FVector::RightVector;
-			if (FMath::Abs(FVector::DotProduct(Normal, Arbitrary)) > 0.99f)
-			{
-				Arbitrary = FVector::UpVector;
-			}
-
-			const FVector Tangent = Arbitrary - Normal * FVector::DotProduct(Arbitrary, Normal);
-			return Tangent.GetSafeNormal();
-		};
-
-	const uint32 NumFaces = FaceCountsProperty->Num(FaceCountsPropertyTrueSampleIndex);
-	uint32 TotalFaceIndices = 0;
-
-	Primitive.Normals.AddZeroed(Primitive.Positions.Num());
+	return true;
+}
 
-	for (uint32 FaceIndex = 0; FaceIndex < NumFaces; FaceIndex++)
+void UglTFRuntimeABCFunctionLibrary::GenerateMikkTSpaceTangents(FglTFRuntimeMeshLOD& RuntimeLOD, const uint32 PositionsTrueSampleIndex, const uint32 NormalsTrueSampleIndex, glTFRuntimeAlembic::FMeshTopologyCache* TopologyCache, const int32 LODIndex)
+{
+	// positions and normals did not change since the last sample, just reuse the tangents
+	if (TopologyCache)
 	{
-		uint32 NumVertices;
-		if (!FaceCountsProperty->Get(FaceCountsPropertyTrueSampleIndex, FaceIndex, 0, NumVertices))
+		FScopeLock TopologyCacheLock(&TopologyCache->Lock);
+		const glTFRuntimeAlembic::FMeshTangentsCache* TangentsCache = TopologyCache->LODsTangents.IsValidIndex(LODIndex) ? &TopologyCache->LODsTangents[LODIndex] : nullptr;
+		if (TangentsCache &&
+			TangentsCache->PositionsTrueSampleIndex == PositionsTrueSampleIndex &&
+			TangentsCache->NormalsTrueSampleIndex == NormalsTrueSampleIndex &&
+			TangentsCache->Tangents.Num() == RuntimeLOD.Primitives.Num())
 		{
-			return false;
+			for (int32 PrimitiveIndex = 0; PrimitiveIndex < RuntimeLOD.Primitives.Num(); PrimitiveIndex++)
+			{
+				RuntimeLOD.Primitives[PrimitiveIndex].Tangents = TangentsCache->Tangents[PrimitiveIndex];
+			}
+			RuntimeLOD.bHasTangents = true;
+			INC_DWORD_STAT(STAT_glTFRuntimeAlembic_MikkTSpaceTangentsCacheHits);
+			return;
 		}
+	}
 
-		TArray<uint32> PositionIndexMap;
-		TArray<FVector> PolygonPositions;
-		TArray<uint32> VertexIndexMap;
-
-		for (uint32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+	// each primitive is an independent MikkTSpace job
+	TArray<bool> Results;
+	Results.AddZeroed(RuntimeLOD.Primitives.Num());
+	ParallelFor(RuntimeLOD.Primitives.Num(), [&](const int32 PrimitiveIndex)
 		{
-			uint32 PositionIndex;
-			if (!FaceIndicesProperty->Get(FaceIndicesPropertyTrueSampleIndex, TotalFaceIndices + VertexIndex, 0, PositionIndex))
+			SCOPE_CYCLE_COUNTER(STAT_glTFRuntimeAlembic_MikkTSpaceTangents);
+			FglTFRuntimePrimitive& Primitive = RuntimeLOD.Primitives[PrimitiveIndex];
+			if (Primitive.UVs.Num() > 0)
 			{
-				return false;
+				Results[PrimitiveIndex] = glTFRuntimeAlembic::ComputeMikkTSpaceTangents(Primitive.Indices, Primitive.Positions, Primitive.Normals, Primitive.UVs[0], Primitive.Tangents);
 			}
+		});
 
-			if (!Primitive.Positions.IsValidIndex(PositionIndex))
-			{
-				return false;
-			}
+	if (Results.Contains(false))
+	{
+		return;
+	}
 
-			PolygonPositions.Add(Primitive.Positions[PositionIndex]);
-			PositionIndexMap.Add(PositionIndex);
-			VertexIndexMap.Add(TotalFaceIndices + VertexIndex);
-		}
+	RuntimeLOD.bHasTangents = true;
 
-		TArray<UE::Geometry::FIndex3i> Triangles;
-		if (NumVertices != 3)
+	if (TopologyCache && LODIndex >= 0)
+	{
+		FScopeLock TopologyCacheLock(&TopologyCache->Lock);
+		if (TopologyCache->LODsTangents.Num() <= LODIndex)
 		{
-			PolygonTriangulation::TriangulateSimplePolygon(PolygonPositions, Triangles);
+			TopologyCache->LODsTangents.SetNum(LODIndex + 1);
 		}
-		else
+		glTFRuntimeAlembic::FMeshTangentsCache& TangentsCache = TopologyCache->LODsTangents[LODIndex];
+		TangentsCache.PositionsTrueSampleIndex = PositionsTrueSampleIndex;
+		TangentsCache.NormalsTrueSampleIndex = NormalsTrueSampleIndex;
+		TangentsCache.Tangents.SetNum(RuntimeLOD.Primitives.Num());
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < RuntimeLOD.Primitives.Num(); PrimitiveIndex++)
 		{
-			Triangles.Add(UE::Geometry::FIndex3i({ 0, 2, 1 }));
+			TangentsCache.Tangents[PrimitiveIndex] = RuntimeLOD.Primitives[PrimitiveIndex].Tangents;
 		}
+	}
+}
 
-		for (uint32 TriangleIndex = 0; TriangleIndex < static_cast<uint32>(Triangles.Num()); TriangleIndex++)
+namespace glTFRuntimeAlembic
+{
+	namespace Groom
+	{
+		template<typename T, typename AttributesSetType>
+		auto GetOrRegisterAttribute(AttributesSetType& AttributesSet, const FName AttributeName)
 		{
-			const uint32 PositionIndexA = PositionIndexMap[Triangles[TriangleIndex].A];
-			const uint32 PositionIndexB = PositionIndexMap[Triangles[TriangleIndex].B];
-			const uint32 PositionIndexC = PositionIndexMap[Triangles[TriangleIndex].C];
-			const uint32 VertexIndexA = VertexIndexMap[Triangles[TriangleIndex].A];
-			const uint32 VertexIndexB = VertexIndexMap[Triangles[TriangleIndex].B];
-			const uint32 VertexIndexC = VertexIndexMap[Triangles[TriangleIndex].C];
-
-			Primitive.Indices.Add(PositionIndexA);
-			Primitive.Indices.Add(PositionIndexB);
-			Primitive.Indices.Add(PositionIndexC);
-
-			if (RuntimeLOD.bHasNormals)
-			{
-				Primitive.Normals[PositionIndexA] += Asset->GetParser()->TransformVector(Normals[VertexIndexA]);
-				Primitive.Normals[PositionIndexB] += Asset->GetParser()->TransformVector(Normals[VertexIndexB]);
-				Primitive.Normals[PositionIndexC] += Asset->GetParser()->TransformVector(Normals[VertexIndexC]);
-			}
-			else
+			auto AttributeRef = AttributesSet.template GetAttributesRef<T>(AttributeName);
+			if (!AttributeRef.IsValid())
 			{
-				const FVector EdgeA = Primitive.Positions[PositionIndexB] - Primitive.Positions[PositionIndexA];
-				const FVector EdgeB = Primitive.Positions[PositionIndexC] - Primitive.Positions[PositionIndexA];
-
-				const FVector GeneratedNormal = FVector::CrossProduct(EdgeB, EdgeA).GetSafeNormal();
-
-				Primitive.Normals[PositionIndexA] += GeneratedNormal;
-				Primitive.Normals[PositionIndexB] += GeneratedNormal;
-				Primitive.Normals[PositionIndexC] += GeneratedNormal;
+				AttributesSet.template RegisterAttribute<T>(AttributeName);
+				AttributeRef = AttributesSet.template GetAttributesRef<T>(AttributeName);
 			}
+			return AttributeRef;
 		}
-
-		TotalFaceIndices += NumVertices;
-	}
-
-	Primitive.Tangents.AddUninitialized(Primitive.Normals.Num());
-	for (int32 NormalIndex = 0; NormalIndex < Primitive.Normals.Num(); NormalIndex++)
-	{
-		Primitive.Normals[NormalIndex].Normalize();
-		Primitive.Tangents[NormalIndex] = ComputeTangent(Primitive.Normals[NormalIndex]);
 	}
-
-	RuntimeLOD.Primitives.Add(MoveTemp(Primitive));
-
-	return true;
 }
 
 UGroomAsset* UglTFRuntimeABCFunctionLibrary::LoadGroomFromAlembicObject(UglTFRuntimeAsset* Asset, const FString& ObjectPath)
@@ -209,71 +1045,185 @@ UGroomAsset* UglTFRuntimeABCFunctionLibrary::LoadGroomFromAlembicObject(UglTFRun
 		return nullptr;
 	}
 
-	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> NumVerticesProperty = Object->FindArrayProperty(".geom/nVertices");
-	if (!NumVerticesProperty)
+	FHairDescription HairDescription;
+	if (!LoadHairDescriptionFromAlembicObject(Asset, *Object, HairDescription))
 	{
 		return nullptr;
 	}
 
-	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> PositionsProperty = Object->FindArrayProperty(".geom/P");
-	if (!PositionsProperty)
+	return LoadGroomFromHairDescription(MoveTemp(HairDescription));
+}
+
+bool UglTFRuntimeABCFunctionLibrary::LoadHairDescriptionFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, FHairDescription& HairDescription)
+{
+	if (!Asset)
 	{
-		return nullptr;
+		return false;
 	}
 
-	uint32 TrueSampleIndex = 0;
-	if (!NumVerticesProperty->GetSampleTrueIndex(0, TrueSampleIndex))
+	glTFRuntimeAlembic::FCurvesSample CurvesSample;
 	{
-		return nullptr;
+		SCOPE_CYCLE_COUNTER(STAT_glTFRuntimeAlembic_CurvesRead);
+		if (!glTFRuntimeAlembic::ReadCurvesSample(Object, 0, CurvesSample))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to read the curves of %s"), *Object.Path);
+			return false;
+		}
 	}
 
-	const uint64 NumStrands = NumVerticesProperty->Num(TrueSampleIndex);
-
+	const int32 NumStrands = CurvesSample.NumStrands();
 	if (NumStrands == 0)
 	{
-		return nullptr;
+		return false;
 	}
 
-	FHairDescription HairDescription;
+	// optional attributes, expanded per strand or per vertex
+	glTFRuntimeAlembic::FCurvesAttribute Widths;
+	glTFRuntimeAlembic::FCurvesAttribute RootUVs;
+	glTFRuntimeAlembic::FCurvesAttribute Colors;
+	glTFRuntimeAlembic::FCurvesAttribute Roughness;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_glTFRuntimeAlembic_CurvesRead);
 
-	uint64 TotalVertexIndex = 0;
+		auto ReadAttribute = [&](const TArray<FString>& PropertyPaths, const uint8 MinExtent, glTFRuntimeAlembic::FCurvesAttribute& Attribute)
+			{
+				for (const FString& PropertyPath : PropertyPaths)
+				{
+					if (glTFRuntimeAlembic::ReadCurvesAttribute(Object, PropertyPath, 0, CurvesSample, Attribute) && Attribute.Extent >= MinExtent)
+					{
+						return;
+					}
+
+					// present but not usable, the next candidate (or the default) is used instead
+					if (Object.FindProperty(PropertyPath))
+					{
+						UE_LOG(LogGLTFRuntime, Warning, TEXT("Ignoring %s of %s: its elements do not map to the strands or to the vertices of the curves"), *PropertyPath, *Object.Path);
+					}
+				}
+				Attribute = glTFRuntimeAlembic::FCurvesAttribute();
+			};
+
+		ReadAttribute({ ".geom/width" }, 1, Widths);
+		ReadAttribute({ ".geom/.arbGeomParams/groom_root_uv", ".geom/uv" }, 2, RootUVs);
+		ReadAttribute({ ".geom/.arbGeomParams/groom_color", ".geom/.arbGeomParams/Cd" }, 3, Colors);
+		ReadAttribute({ ".geom/.arbGeomParams/groom_roughness" }, 1, Roughness);
+	}
 
-	for (uint64 StrandIndex = 0; StrandIndex < NumStrands; StrandIndex++)
 	{
-		FStrandID StrandID = HairDescription.AddStrand();
+		SCOPE_CYCLE_COUNTER(STAT_glTFRuntimeAlembic_HairDescriptionFill);
 
-		uint32 NumVertices = 0;
-		if (!NumVerticesProperty->Get(TrueSampleIndex, StrandIndex, 0, NumVertices))
+		// every strand and vertex is allocated up front, their attributes are then filled in parallel
+		HairDescription.InitializeStrands(NumStrands);
+		HairDescription.InitializeVertices(CurvesSample.Positions.Num());
+
+		TStrandAttributesRef<int32> VertexCountStrandAttributeRef = glTFRuntimeAlembic::Groom::GetOrRegisterAttribute<int32>(HairDescription.StrandAttributes(), HairAttribute::Strand::VertexCount);
+		TVertexAttributesRef<FVector3f> PositionVertexAttributeRef = glTFRuntimeAlembic::Groom::GetOrRegisterAttribute<FVector3f>(HairDescription.VertexAttributes(), HairAttribute::Vertex::Position);
+
+		// per vertex widths replace the strand ones, strands without any width get the default one
+		TStrandAttributesRef<float> WidthStrandAttributeRef;
+		TVertexAttributesRef<float> WidthVertexAttributeRef;
+		if (Widths.bPerVertex)
 		{
-			return nullptr;
+			WidthVertexAttributeRef = glTFRuntimeAlembic::Groom::GetOrRegisterAttribute<float>(HairDescription.VertexAttributes(), HairAttribute::Vertex::Width);
+		}
+		else
+		{
+			WidthStrandAttributeRef = glTFRuntimeAlembic::Groom::GetOrRegisterAttribute<float>(HairDescription.StrandAttributes(), HairAttribute::Strand::Width);
 		}
 
-		SetHairStrandAttribute(HairDescription, StrandID, HairAttribute::Strand::VertexCount, static_cast<int32>(NumVertices));
-
-		for (uint32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+		TStrandAttributesRef<FVector2f> RootUVStrandAttributeRef;
+		if (RootUVs.IsValid())
 		{
-			FVector Position;
-			if (!PositionsProperty->Get(TrueSampleIndex, TotalVertexIndex + VertexIndex, Position))
-			{
-				return nullptr;
-			}
+			RootUVStrandAttributeRef = glTFRuntimeAlembic::Groom::GetOrRegisterAttribute<FVector2f>(HairDescription.StrandAttributes(), HairAttribute::Strand::RootUV);
+		}
 
-			FVertexID VertexID = HairDescription.AddVertex();
-			SetHairVertexAttribute(HairDescription, VertexID, HairAttribute::Vertex::Position, FVector3f(Asset->GetParser()->TransformPosition(Position)));
+		TStrandAttributesRef<FVector3f> ColorStrandAttributeRef;
+		TVertexAttributesRef<FVector3f> ColorVertexAttributeRef;
+		if (Colors.IsValid() && Colors.bPerVertex)
+		{
+			ColorVertexAttributeRef = glTFRuntimeAlembic::Groom::GetOrRegisterAttribute<FVector3f>(HairDescription.VertexAttributes(), HairAttribute::Vertex::Color);
+		}
+		else if (Colors.IsValid())
+		{
+			ColorStrandAttributeRef = glTFRuntimeAlembic::Groom::GetOrRegisterAttribute<FVector3f>(HairDescription.StrandAttributes(), HairAttribute::Strand::Color);
 		}
 
-		TStrandAttributesRef<float> WidthStrandAttributeRef = HairDescription.StrandAttributes().GetAttributesRef<float>(HairAttribute::Strand::Width);
-		if (!WidthStrandAttributeRef.IsValid())
+		TStrandAttributesRef<float> RoughnessStrandAttributeRef;
+		TVertexAttributesRef<float> RoughnessVertexAttributeRef;
+		if (Roughness.IsValid() && Roughness.bPerVertex)
 		{
-			HairDescription.StrandAttributes().RegisterAttribute<float>(HairAttribute::Strand::Width);
-			WidthStrandAttributeRef = HairDescription.StrandAttributes().GetAttributesRef<float>(HairAttribute::Strand::Width);
+			RoughnessVertexAttributeRef = glTFRuntimeAlembic::Groom::GetOrRegisterAttribute<float>(HairDescription.VertexAttributes(), HairAttribute::Vertex::Roughness);
+		}
+		else if (Roughness.IsValid())
+		{
+			RoughnessStrandAttributeRef = glTFRuntimeAlembic::Groom::GetOrRegisterAttribute<float>(HairDescription.StrandAttributes(), HairAttribute::Strand::Roughness);
 		}
 
-		WidthStrandAttributeRef[StrandID] = 0.01f;
+		// a single reference for all the workers
+		auto Parser = Asset->GetParser();
+		// widths are diameters in Alembic units
+		const float WidthScale = Parser->TransformPosition(FVector(1, 0, 0)).Size();
 
-		TotalVertexIndex += NumVertices;
+		ParallelFor(NumStrands, [&](const int32 StrandIndex)
+			{
+				const FStrandID StrandID(StrandIndex);
+				const int32 FirstVertexIndex = CurvesSample.Offsets[StrandIndex];
+				const int32 LastVertexIndex = CurvesSample.Offsets[StrandIndex + 1];
+
+				VertexCountStrandAttributeRef[StrandID] = LastVertexIndex - FirstVertexIndex;
+
+				if (!Widths.bPerVertex)
+				{
+					WidthStrandAttributeRef[StrandID] = Widths.IsValid() ? Widths.GetValue(StrandIndex)[0] * WidthScale : 0.01f;
+				}
+
+				// per vertex UVs are sampled at the root
+				if (RootUVs.IsValid())
+				{
+					const float* RootUV = RootUVs.GetValue(RootUVs.bPerVertex ? FirstVertexIndex : StrandIndex);
+					RootUVStrandAttributeRef[StrandID] = FVector2f(RootUV[0], 1 - RootUV[1]);
+				}
+
+				if (Colors.IsValid() && !Colors.bPerVertex)
+				{
+					const float* Color = Colors.GetValue(StrandIndex);
+					ColorStrandAttributeRef[StrandID] = FVector3f(Color[0], Color[1], Color[2]);
+				}
+
+				if (Roughness.IsValid() && !Roughness.bPerVertex)
+				{
+					RoughnessStrandAttributeRef[StrandID] = Roughness.GetValue(StrandIndex)[0];
+				}
+
+				for (int32 VertexIndex = FirstVertexIndex; VertexIndex < LastVertexIndex; VertexIndex++)
+				{
+					const FVertexID VertexID(VertexIndex);
+					PositionVertexAttributeRef[VertexID] = FVector3f(Parser->TransformPosition(FVector(CurvesSample.Positions[VertexIndex])));
+
+					if (Widths.bPerVertex)
+					{
+						WidthVertexAttributeRef[VertexID] = Widths.GetValue(VertexIndex)[0] * WidthScale;
+					}
+
+					if (Colors.bPerVertex)
+					{
+						const float* Color = Colors.GetValue(VertexIndex);
+						ColorVertexAttributeRef[VertexID] = FVector3f(Color[0], Color[1], Color[2]);
+					}
+
+					if (Roughness.bPerVertex)
+					{
+						RoughnessVertexAttributeRef[VertexID] = Roughness.GetValue(VertexIndex)[0];
+					}
+				}
+			});
 	}
 
+	return true;
+}
+
+UGroomAsset* UglTFRuntimeABCFunctionLibrary::LoadGroomFromHairDescription(FHairDescription&& HairDescription, const bool bEnableSimulation)
+{
 	UGroomAsset* GroomAsset = NewObject<UGroomAsset>(GetTransientPackage(), NAME_None, RF_Public);
 	GroomAsset->SetNumGroup(1);
 
@@ -285,7 +1235,7 @@ UGroomAsset* UglTFRuntimeABCFunctionLibrary::LoadGroomFromAlembicObject(UglTFRun
 
 	TArray<FHairGroupPlatformData>& OutHairGroupsData = GroomAsset->GetHairGroupsPlatformData();
 
-	GroomAsset->GetHairGroupsPhysics()[0].SolverSettings.EnableSimulation = true;
+	GroomAsset->GetHairGroupsPhysics()[0].SolverSettings.EnableSimulation = bEnableSimulation;
 
 	OutHairGroupsData[0].Cards.LODs.SetNum(1);
 	OutHairGroupsData[0].Meshes.LODs.SetNum(1);
@@ -346,6 +1296,200 @@ UGroomAsset* UglTFRuntimeABCFunctionLibrary::LoadGroomFromAlembicObject(UglTFRun
 	return GroomAsset;
 }
 
+bool UglTFRuntimeABCFunctionLibrary::UpdateHairDescriptionPositions(UglTFRuntimeAsset* Asset, FHairDescription& HairDescription, const TArray<FVector3f>& Positions)
+{
+	if (!Asset)
+	{
+		return false;
+	}
+
+	TVertexAttributesRef<FVector3f> PositionVertexAttributeRef = HairDescription.VertexAttributes().GetAttributesRef<FVector3f>(HairAttribute::Vertex::Position);
+	if (!PositionVertexAttributeRef.IsValid() || HairDescription.GetNumVertices() != Positions.Num())
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to update the hair description: %d positions for %d vertices"), Positions.Num(), HairDescription.GetNumVertices());
+		return false;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_glTFRuntimeAlembic_HairDescriptionFill);
+
+	// a single reference for all the workers
+	auto Parser = Asset->GetParser();
+
+	ParallelFor(Positions.Num(), [&](const int32 VertexIndex)
+		{
+			PositionVertexAttributeRef[FVertexID(VertexIndex)] = FVector3f(Parser->TransformPosition(FVector(Positions[VertexIndex])));
+		});
+
+	return true;
+}
+
+TSharedPtr<glTFRuntimeAlembic::FCompressedFrameStore> UglTFRuntimeABCFunctionLibrary::LoadCompressedFrameStoreFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, const int32 KeyframeInterval, glTFRuntimeAlembic::FMeshTopologyCache* TopologyCache)
+{
+	if (!Asset)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> PositionsProperty = Object.FindArrayProperty(".geom/P");
+	if (!PositionsProperty)
+	{
+		return nullptr;
+	}
+
+	const int32 NumSamples = static_cast<int32>(PositionsProperty->NextSampleIndex);
+
+	TSharedPtr<glTFRuntimeAlembic::FCompressedFrameStore> FrameStore = MakeShared<glTFRuntimeAlembic::FCompressedFrameStore>();
+
+	// a block is decoded in parallel and compressed before moving to the next one, so only a block of full precision frames is alive at any time
+	const int32 BlockSize = FMath::Max(KeyframeInterval, 1);
+	TArray<FglTFRuntimeMeshLOD> BlockFrames;
+	TArray<bool> Results;
+	for (int32 FirstSampleIndex = 0; FirstSampleIndex < NumSamples; FirstSampleIndex += BlockSize)
+	{
+		const int32 NumBlockFrames = FMath::Min(BlockSize, NumSamples - FirstSampleIndex);
+		BlockFrames.Reset();
+		BlockFrames.SetNum(NumBlockFrames);
+		Results.Init(false, NumBlockFrames);
+
+		ParallelFor(NumBlockFrames, [&](const int32 BlockFrameIndex)
+			{
+				Results[BlockFrameIndex] = LoadRuntimeLODFromAlembicObject(Asset, Object, FirstSampleIndex + BlockFrameIndex, BlockFrames[BlockFrameIndex], StaticMeshMaterialsConfig, AlembicConfig, TopologyCache);
+			});
+
+		if (Results.Contains(false) || !FrameStore->AddBlock(BlockFrames))
+		{
+			return nullptr;
+		}
+	}
+
+	UE_LOG(LogGLTFRuntime, Log, TEXT("Compressed %d samples of %s from %lld to %lld bytes (ratio %.2f)"), NumSamples, *Object.Path, FrameStore->GetUncompressedSize(), FrameStore->GetCompressedSize(), FrameStore->GetCompressionRatio());
+
+	return FrameStore;
+}
+
+TSharedPtr<glTFRuntimeAlembic::FCompressedCurvesStore> UglTFRuntimeABCFunctionLibrary::LoadCompressedCurvesStoreFromAlembicObject(const glTFRuntimeAlembic::FObject& Object, const int32 KeyframeInterval)
+{
+	TSharedPtr<glTFRuntimeAlembic::FCompressedCurvesStore> CurvesStore = MakeShared<glTFRuntimeAlembic::FCompressedCurvesStore>();
+	if (!CurvesStore->Build(Object, KeyframeInterval))
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to compress the curves of %s, their strands must be the same in every sample"), *Object.Path);
+		return nullptr;
+	}
+
+	return CurvesStore;
+}
+
+bool UglTFRuntimeABCFunctionLibrary::LoadGroomCacheFramesFromCurvesStore(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FCompressedCurvesStore& CurvesStore, const FHairDescription& HairDescription, const int32 BlockSize, FGroomCacheProcessor& Processor)
+{
+	if (!Asset)
+	{
+		return false;
+	}
+
+	// the same settings of LoadGroomFromHairDescription, so the strands of every frame match the ones of the groom asset
+	FHairGroupsInterpolation HairGroupsInterpolation;
+	HairGroupsInterpolation.InterpolationSettings.bUseUniqueGuide = true;
+
+	const int32 NumFrames = CurvesStore.NumFrames();
+
+	// the samples are added in order, a block of them is built in parallel
+	const int32 FramesPerBlock = FMath::Max(BlockSize, 1);
+	TArray<TArray<FGroomCacheGroupData>> BlockGroupsData;
+	TArray<bool> Results;
+	for (int32 FirstFrameIndex = 0; FirstFrameIndex < NumFrames; FirstFrameIndex += FramesPerBlock)
+	{
+		const int32 NumBlockFrames = FMath::Min(FramesPerBlock, NumFrames - FirstFrameIndex);
+		BlockGroupsData.Reset();
+		BlockGroupsData.SetNum(NumBlockFrames);
+		Results.Init(false, NumBlockFrames);
+
+		ParallelFor(NumBlockFrames, [&](const int32 BlockFrameIndex)
+			{
+				TArray<FVector3f> Positions;
+				{
+					SCOPE_CYCLE_COUNTER(STAT_glTFRuntimeAlembic_FrameStoreDecode);
+					if (!CurvesStore.DecodeFrame(FirstFrameIndex + BlockFrameIndex, Positions))
+					{
+						return;
+					}
+				}
+
+				FHairDescription FrameHairDescription = HairDescription;
+				if (!UpdateHairDescriptionPositions(Asset, FrameHairDescription, Positions))
+				{
+					return;
+				}
+
+				FHairDescriptionGroups HairDescriptionGroups;
+				FGroomBuilder::BuildHairDescriptionGroups(FrameHairDescription, HairDescriptionGroups);
+				if (HairDescriptionGroups.HairGroups.Num() != 1)
+				{
+					return;
+				}
+
+				FHairGroupInfo HairGroupInfo;
+				FHairStrandsDatas StrandsData;
+				FHairStrandsDatas GuidesData;
+				FGroomBuilder::BuildData(HairDescriptionGroups.HairGroups[0], HairGroupsInterpolation, HairGroupInfo, StrandsData, GuidesData, true/*bAllowCurveReordering*/, true/*bApplyDecimation*/, false);
+
+				FGroomCacheGroupData& GroupData = BlockGroupsData[BlockFrameIndex].AddDefaulted_GetRef();
+				GroupData.VertexData = MoveTemp(StrandsData.StrandsPoints);
+				GroupData.StrandData = MoveTemp(StrandsData.StrandsCurves);
+				GroupData.BoundingBox = StrandsData.BoundingBox;
+
+				Results[BlockFrameIndex] = true;
+			});
+
+		if (Results.Contains(false))
+		{
+			UE_LOG(LogGLTFRuntime, Error, TEXT("Unable to build the groom cache frames %d-%d"), FirstFrameIndex, FirstFrameIndex + NumBlockFrames - 1);
+			return false;
+		}
+
+		for (TArray<FGroomCacheGroupData>& GroupsData : BlockGroupsData)
+		{
+			Processor.AddGroomSample(MoveTemp(GroupsData));
+		}
+	}
+
+	return true;
+}
+
+UGroomCache* UglTFRuntimeABCFunctionLibrary::LoadGroomCacheFromProcessor(FGroomCacheProcessor& Processor, const int32 NumFrames, const float FramesPerSecond)
+{
+	if (NumFrames <= 0 || FramesPerSecond <= 0)
+	{
+		return nullptr;
+	}
+
+	FGroomAnimationInfo AnimationInfo;
+	AnimationInfo.NumFrames = NumFrames;
+	AnimationInfo.SecondsPerFrame = 1 / FramesPerSecond;
+	AnimationInfo.Duration = (NumFrames - 1) * AnimationInfo.SecondsPerFrame;
+	AnimationInfo.StartTime = 0;
+	AnimationInfo.EndTime = AnimationInfo.Duration;
+	AnimationInfo.StartFrame = 0;
+	AnimationInfo.EndFrame = NumFrames - 1;
+	AnimationInfo.Attributes = EGroomCacheAttributes::Position;
+
+	UGroomCache* GroomCache = NewObject<UGroomCache>(GetTransientPackage(), NAME_None, RF_Public);
+	GroomCache->Initialize(EGroomCacheType::Strands);
+	GroomCache->SetGroomAnimationInfo(AnimationInfo);
+	Processor.TransferChunks(GroomCache);
+
+	return GroomCache;
+}
+
+bool UglTFRuntimeABCFunctionLibrary::LoadAlembicObjectIntoGroomCacheComponent(UglTFRuntimeAsset* Asset, const FString& ObjectPath, UglTFRuntimeAlembicGroomCacheComponent* GroomCacheComponent)
+{
+	if (!Asset || !GroomCacheComponent)
+	{
+		return false;
+	}
+
+	return GroomCacheComponent->OpenAlembicObject(Asset, ObjectPath);
+}
+
 bool UglTFRuntimeABCFunctionLibrary::LoadAlembicObjectIntoSplineComponent(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const int32 SampleIndex, USplineComponent* SplineComponent)
 {
 	if (!Asset || !SplineComponent)
@@ -423,6 +1567,40 @@ bool UglTFRuntimeABCFunctionLibrary::LoadAlembicObjectIntoSplineComponent(UglTFR
 	return true;
 }
 
+bool UglTFRuntimeABCFunctionLibrary::GetAlembicObjectVertexCacheMetrics(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const int32 SampleIndex, FglTFRuntimeAlembicVertexCacheMetrics& Metrics)
+{
+	if (!Asset)
+	{
+		return false;
+	}
+
+	TSharedPtr<glTFRuntimeAlembic::FObject> Root = glTFRuntimeAlembic::ParseArchive(Asset->GetParser()->GetBlob());
+	if (!Root)
+	{
+		return false;
+	}
+
+	TSharedPtr<const glTFRuntimeAlembic::FObject> Object = Root->Find(ObjectPath);
+	if (!Object)
+	{
+		return false;
+	}
+
+	FglTFRuntimeAlembicConfig AlembicConfig;
+	AlembicConfig.bOptimizeVertexCache = true;
+
+	glTFRuntimeAlembic::FMeshTopologyCache TopologyCache;
+	FglTFRuntimeMeshLOD RuntimeLOD;
+	if (!LoadRuntimeLODFromAlembicObject(Asset, *Object, SampleIndex, RuntimeLOD, FglTFRuntimeMaterialsConfig(), AlembicConfig, &TopologyCache))
+	{
+		return false;
+	}
+
+	Metrics = TopologyCache.Topology->VertexCacheMetrics;
+
+	return true;
+}
+
 bool UglTFRuntimeABCFunctionLibrary::GetAlembicObjectPropertiesNames(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const FString& CompoundPropertyPath, TArray<FString>& PropertiesNames)
 {
 	if (!Asset)
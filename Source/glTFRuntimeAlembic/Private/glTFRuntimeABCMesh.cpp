@@ -0,0 +1,1640 @@
+// Copyright 2025 - Roberto De Ioris
+
+#include "glTFRuntimeABCMesh.h"
+#include "Async/ParallelFor.h"
+#include "CompGeom/PolygonTriangulation.h"
+#include "mikktspace.h"
+#include <atomic>
+
+namespace glTFRuntimeAlembic
+{
+	bool FVertexTriangleAdjacency::Build(const TArrayView<const uint32> Indices, const int32 NumVertices)
+	{
+		Offsets.Reset();
+		Triangles.Reset();
+
+		if (NumVertices < 0 || Indices.Num() % 3 != 0)
+		{
+			return false;
+		}
+
+		Offsets.AddZeroed(NumVertices + 1);
+
+		// count
+		for (const uint32 Index : Indices)
+		{
+			if (Index >= static_cast<uint32>(NumVertices))
+			{
+				Offsets.Reset();
+				return false;
+			}
+			Offsets[Index + 1]++;
+		}
+
+		// prefix sum
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+		{
+			Offsets[VertexIndex + 1] += Offsets[VertexIndex];
+		}
+
+		// fill (triangles end up sorted per vertex, so the result is deterministic)
+		TArray<uint32> Cursors(Offsets.GetData(), NumVertices);
+		Triangles.AddUninitialized(Indices.Num());
+		for (int32 CornerIndex = 0; CornerIndex < Indices.Num(); CornerIndex++)
+		{
+			Triangles[Cursors[Indices[CornerIndex]]++] = CornerIndex / 3;
+		}
+
+		return true;
+	}
+
+	EGeomScope GetGeomScope(const TMap<FString, FString>& Metadata)
+	{
+		const FString* Scope = Metadata.Find("geoScope");
+		if (!Scope)
+		{
+			return EGeomScope::Unknown;
+		}
+
+		if (*Scope == "con")
+		{
+			return EGeomScope::Constant;
+		}
+		else if (*Scope == "uni")
+		{
+			return EGeomScope::Uniform;
+		}
+		else if (*Scope == "var")
+		{
+			return EGeomScope::Varying;
+		}
+		else if (*Scope == "vtx")
+		{
+			return EGeomScope::Vertex;
+		}
+		else if (*Scope == "fvr")
+		{
+			return EGeomScope::FaceVarying;
+		}
+
+		return EGeomScope::Unknown;
+	}
+
+	bool ReadGeomParam(const FObject& Object, const FString& PropertyPath, const uint32 SampleIndex, FGeomParamSample& Sample)
+	{
+		TSharedPtr<IProperty> Property = Object.FindProperty(PropertyPath);
+		if (!Property)
+		{
+			return false;
+		}
+
+		TSharedPtr<FArrayProperty> ValuesProperty = nullptr;
+		TSharedPtr<FArrayProperty> IndicesProperty = nullptr;
+
+		// indexed geom param
+		if (Property->bIsCompound)
+		{
+			ValuesProperty = Object.FindArrayProperty(PropertyPath + "/.vals");
+			IndicesProperty = Object.FindArrayProperty(PropertyPath + "/.indices");
+			if (!ValuesProperty || !IndicesProperty)
+			{
+				return false;
+			}
+		}
+		else
+		{
+			ValuesProperty = Object.FindArrayProperty(PropertyPath);
+			if (!ValuesProperty)
+			{
+				return false;
+			}
+		}
+
+		Sample.Scope = GetGeomScope(Property->Metadata);
+		if (Sample.Scope == EGeomScope::Unknown)
+		{
+			Sample.Scope = GetGeomScope(ValuesProperty->Metadata);
+		}
+
+		Sample.Extent = ValuesProperty->Extent;
+
+		if (!ValuesProperty->GetSampleTrueIndex(SampleIndex, Sample.ValuesTrueSampleIndex))
+		{
+			return false;
+		}
+
+		if (!ValuesProperty->GetValues(Sample.ValuesTrueSampleIndex, Sample.Values))
+		{
+			return false;
+		}
+
+		Sample.Indices.Reset();
+		Sample.IndicesTrueSampleIndex = 0;
+
+		if (IndicesProperty)
+		{
+			if (!IndicesProperty->GetSampleTrueIndex(SampleIndex, Sample.IndicesTrueSampleIndex))
+			{
+				return false;
+			}
+
+			if (!IndicesProperty->GetValues(Sample.IndicesTrueSampleIndex, Sample.Indices))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	TSharedPtr<FMeshTopology> BuildMeshTopology(const TSharedRef<FArrayProperty>& FaceIndicesProperty, const uint32 FaceIndicesTrueSampleIndex, const TSharedRef<FArrayProperty>& FaceCountsProperty, const uint32 FaceCountsTrueSampleIndex, const TArrayView<const FVector> Positions, const FGeomParamSample* UVs, const TArray<FFaceSet>* FaceSets)
+	{
+		TSharedRef<FMeshTopology> Topology = MakeShared<FMeshTopology>();
+		Topology->FaceIndicesTrueSampleIndex = FaceIndicesTrueSampleIndex;
+		Topology->FaceCountsTrueSampleIndex = FaceCountsTrueSampleIndex;
+		Topology->NumPositions = Positions.Num();
+
+		const uint32 NumFaces = FaceCountsProperty->Num(FaceCountsTrueSampleIndex);
+		uint32 TotalFaceIndices = 0;
+
+		Topology->Indices.Reserve(FaceIndicesProperty->Num(FaceIndicesTrueSampleIndex) * 3);
+		Topology->FaceVertexIndices.Reserve(Topology->Indices.Max());
+		Topology->TriangleFaces.Reserve(Topology->Indices.Max() / 3);
+
+		TArray<uint32> PositionIndexMap;
+		TArray<FVector> PolygonPositions;
+		TArray<UE::Geometry::FIndex3i> Triangles;
+
+		for (uint32 FaceIndex = 0; FaceIndex < NumFaces; FaceIndex++)
+		{
+			uint32 NumVertices;
+			if (!FaceCountsProperty->Get(FaceCountsTrueSampleIndex, FaceIndex, 0, NumVertices))
+			{
+				return nullptr;
+			}
+
+			PositionIndexMap.Reset();
+			PolygonPositions.Reset();
+			Triangles.Reset();
+
+			for (uint32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+			{
+				uint32 PositionIndex;
+				if (!FaceIndicesProperty->Get(FaceIndicesTrueSampleIndex, TotalFaceIndices + VertexIndex, 0, PositionIndex))
+				{
+					return nullptr;
+				}
+
+				if (!Positions.IsValidIndex(PositionIndex))
+				{
+					return nullptr;
+				}
+
+				PolygonPositions.Add(Positions[PositionIndex]);
+				PositionIndexMap.Add(PositionIndex);
+			}
+
+			if (NumVertices != 3)
+			{
+				PolygonTriangulation::TriangulateSimplePolygon(PolygonPositions, Triangles);
+			}
+			else
+			{
+				Triangles.Add(UE::Geometry::FIndex3i({ 0, 2, 1 }));
+			}
+
+			for (const UE::Geometry::FIndex3i& Triangle : Triangles)
+			{
+				Topology->Indices.Add(PositionIndexMap[Triangle.A]);
+				Topology->Indices.Add(PositionIndexMap[Triangle.B]);
+				Topology->Indices.Add(PositionIndexMap[Triangle.C]);
+				Topology->FaceVertexIndices.Add(TotalFaceIndices + Triangle.A);
+				Topology->FaceVertexIndices.Add(TotalFaceIndices + Triangle.B);
+				Topology->FaceVertexIndices.Add(TotalFaceIndices + Triangle.C);
+				Topology->TriangleFaces.Add(FaceIndex);
+			}
+
+			TotalFaceIndices += NumVertices;
+		}
+
+		if (!Topology->Adjacency.Build(Topology->Indices, Topology->NumPositions))
+		{
+			return nullptr;
+		}
+
+		if (UVs)
+		{
+			Topology->UVsKey = FMeshTopology::GetUVsKey(UVs);
+
+			const uint32 NumElements = UVs->NumElements();
+
+			// non-indexed values are deduplicated, so that only real seams split vertices
+			TArray<uint32> CanonicalElements;
+			if (UVs->Indices.Num() == 0 && UVs->Extent == 2)
+			{
+				TMap<uint64, uint32> ElementsMap;
+				ElementsMap.Reserve(NumElements);
+				CanonicalElements.AddUninitialized(NumElements);
+				for (uint32 ElementIndex = 0; ElementIndex < NumElements; ElementIndex++)
+				{
+					uint64 ElementBits;
+					FMemory::Memcpy(&ElementBits, UVs->Values.GetData() + ElementIndex * 2, sizeof(uint64));
+					CanonicalElements[ElementIndex] = ElementsMap.FindOrAdd(ElementBits, ElementIndex);
+				}
+			}
+
+			TMap<uint64, uint32> VerticesMap;
+			VerticesMap.Reserve(Topology->NumPositions);
+			Topology->VertexIndices.AddUninitialized(Topology->Indices.Num());
+
+			for (int32 CornerIndex = 0; CornerIndex < Topology->Indices.Num(); CornerIndex++)
+			{
+				const uint32 PositionIndex = Topology->Indices[CornerIndex];
+				uint32 ElementIndex = UVs->GetElementIndex(Topology->TriangleFaces[CornerIndex / 3], Topology->FaceVertexIndices[CornerIndex], PositionIndex);
+				if (ElementIndex >= NumElements)
+				{
+					return nullptr;
+				}
+
+				if (CanonicalElements.Num() > 0)
+				{
+					ElementIndex = CanonicalElements[ElementIndex];
+				}
+
+				const uint64 VertexKey = (static_cast<uint64>(PositionIndex) << 32) | ElementIndex;
+				if (const uint32* VertexIndex = VerticesMap.Find(VertexKey))
+				{
+					Topology->VertexIndices[CornerIndex] = *VertexIndex;
+				}
+				else
+				{
+					const uint32 NewVertexIndex = Topology->VertexPositions.Add(PositionIndex);
+					Topology->VertexUVs.Add(ElementIndex);
+					VerticesMap.Add(VertexKey, NewVertexIndex);
+					Topology->VertexIndices[CornerIndex] = NewVertexIndex;
+				}
+			}
+		}
+
+		if (FaceSets && FaceSets->Num() > 0)
+		{
+			Topology->FaceSetsKey = FMeshTopology::GetFaceSetsKey(FaceSets);
+			BuildMeshSections(*Topology, *FaceSets);
+		}
+
+		return Topology;
+	}
+
+	bool ReadFaceSets(const FObject& Object, const uint32 SampleIndex, TArray<FFaceSet>& FaceSets)
+	{
+		FaceSets.Reset();
+
+		for (const TSharedRef<FObject>& Child : Object.Children)
+		{
+			if (Child->GetSchema() != "AbcGeom_FaceSet_v1")
+			{
+				continue;
+			}
+
+			TSharedPtr<FArrayProperty> FacesProperty = Child->FindArrayProperty(".faceset/.faces");
+			if (!FacesProperty)
+			{
+				return false;
+			}
+
+			FFaceSet& FaceSet = FaceSets.AddDefaulted_GetRef();
+			FaceSet.Name = Child->Name;
+
+			if (!FacesProperty->GetSampleTrueIndex(SampleIndex, FaceSet.TrueSampleIndex))
+			{
+				// static face sets on animated meshes only have the first sample
+				if (!FacesProperty->GetSampleTrueIndex(0, FaceSet.TrueSampleIndex))
+				{
+					return false;
+				}
+			}
+
+			if (!FacesProperty->GetValues(FaceSet.TrueSampleIndex, FaceSet.Faces))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool GetMeshDigest(const FObject& Object, const uint32 SampleIndex, FSampleDigest& Digest)
+	{
+		Digest = FSampleDigest();
+
+		auto CombinePropertyDigest = [SampleIndex, &Digest](const FObject& PropertyObject, const FString& PropertyPath, const bool bRequired)
+			{
+				TSharedPtr<FArrayProperty> Property = PropertyObject.FindArrayProperty(PropertyPath);
+				if (!Property)
+				{
+					return !bRequired;
+				}
+
+				uint32 TrueSampleIndex;
+				if (!Property->GetSampleTrueIndex(SampleIndex, TrueSampleIndex))
+				{
+					// static face sets on animated meshes only have the first sample
+					if (!Property->GetSampleTrueIndex(0, TrueSampleIndex))
+					{
+						return false;
+					}
+				}
+
+				FSampleDigest PropertyDigest;
+				if (!Property->GetDigest(TrueSampleIndex, PropertyDigest))
+				{
+					return false;
+				}
+
+				Digest.Combine(PropertyDigest);
+				return true;
+			};
+
+		if (!CombinePropertyDigest(Object, ".geom/P", true) ||
+			!CombinePropertyDigest(Object, ".geom/.faceIndices", true) ||
+			!CombinePropertyDigest(Object, ".geom/.faceCounts", true) ||
+			!CombinePropertyDigest(Object, ".geom/N", false) ||
+			!CombinePropertyDigest(Object, ".geom/uv", false) ||
+			!CombinePropertyDigest(Object, ".geom/uv/.vals", false) ||
+			!CombinePropertyDigest(Object, ".geom/uv/.indices", false))
+		{
+			return false;
+		}
+
+		// face set names end up as material names
+		for (const TSharedRef<FObject>& Child : Object.Children)
+		{
+			if (Child->GetSchema() != "AbcGeom_FaceSet_v1")
+			{
+				continue;
+			}
+
+			if (!CombinePropertyDigest(*Child, ".faceset/.faces", true))
+			{
+				return false;
+			}
+
+			FSampleDigest NameDigest;
+			NameDigest.Low = FCrc::StrCrc32(*Child->Name);
+			Digest.Combine(NameDigest);
+		}
+
+		return true;
+	}
+
+	bool GetMeshSampleVersion(const FObject& Object, const uint32 SampleIndex, FMeshSampleVersion& Version)
+	{
+		Version = FMeshSampleVersion();
+
+		auto GetTrueSampleIndex = [SampleIndex](const FObject& PropertyObject, const FString& PropertyPath, uint32& TrueSampleIndex)
+			{
+				TSharedPtr<FArrayProperty> Property = PropertyObject.FindArrayProperty(PropertyPath);
+				if (!Property)
+				{
+					return false;
+				}
+
+				// static face sets on animated meshes only have the first sample
+				return Property->GetSampleTrueIndex(SampleIndex, TrueSampleIndex) || Property->GetSampleTrueIndex(0, TrueSampleIndex);
+			};
+
+		if (!GetTrueSampleIndex(Object, ".geom/P", Version.PositionsTrueSampleIndex))
+		{
+			return false;
+		}
+
+		if (!GetTrueSampleIndex(Object, ".geom/N", Version.NormalsTrueSampleIndex))
+		{
+			Version.NormalsTrueSampleIndex = MAX_uint32;
+		}
+
+		uint64 TopologyKey = 0;
+		auto CombineTopologyKey = [&](const FObject& PropertyObject, const FString& PropertyPath, const bool bRequired)
+			{
+				uint32 TrueSampleIndex = MAX_uint32;
+				if (!GetTrueSampleIndex(PropertyObject, PropertyPath, TrueSampleIndex) && bRequired)
+				{
+					return false;
+				}
+
+				TopologyKey = (TopologyKey * 31) + TrueSampleIndex;
+				return true;
+			};
+
+		if (!CombineTopologyKey(Object, ".geom/.faceIndices", true) ||
+			!CombineTopologyKey(Object, ".geom/.faceCounts", true) ||
+			!CombineTopologyKey(Object, ".geom/uv", false) ||
+			!CombineTopologyKey(Object, ".geom/uv/.vals", false) ||
+			!CombineTopologyKey(Object, ".geom/uv/.indices", false))
+		{
+			return false;
+		}
+
+		for (const TSharedRef<FObject>& Child : Object.Children)
+		{
+			if (Child->GetSchema() == "AbcGeom_FaceSet_v1" && !CombineTopologyKey(*Child, ".faceset/.faces", true))
+			{
+				return false;
+			}
+		}
+
+		Version.TopologyKey = TopologyKey == MAX_uint64 ? 0 : TopologyKey;
+		return true;
+	}
+
+	namespace Interpolation
+	{
+		// multiple of 4 so that only the very last chunk has a scalar tail
+		constexpr int32 ChunkSize = 16 * 1024;
+
+		// FVector components are contiguous, so arrays of vectors are processed as flat streams of doubles (4 lanes at a time)
+		template<typename VectorOpType, typename ScalarOpType>
+		void ForEachValue(const int32 NumValues, VectorOpType VectorOp, ScalarOpType ScalarOp)
+		{
+			ParallelFor(FMath::DivideAndRoundUp(NumValues, ChunkSize), [&](const int32 ChunkIndex)
+				{
+					const int32 LastValueIndex = FMath::Min((ChunkIndex + 1) * ChunkSize, NumValues);
+					int32 ValueIndex = ChunkIndex * ChunkSize;
+					for (; ValueIndex + 4 <= LastValueIndex; ValueIndex += 4)
+					{
+						VectorOp(ValueIndex);
+					}
+					for (; ValueIndex < LastValueIndex; ValueIndex++)
+					{
+						ScalarOp(ValueIndex);
+					}
+				});
+		}
+	}
+
+	void LerpPositions(const TArrayView<const FVector> From, const TArrayView<const FVector> To, const float Alpha, const TArrayView<FVector> Positions)
+	{
+		static_assert(sizeof(FVector) == sizeof(double) * 3, "FVector must be 3 contiguous doubles");
+		check(From.Num() == Positions.Num() && To.Num() == Positions.Num());
+
+		if (Positions.Num() == 0)
+		{
+			return;
+		}
+
+		const double* FromValues = &From[0].X;
+		const double* ToValues = &To[0].X;
+		double* Values = &Positions[0].X;
+		const VectorRegister4Double AlphaRegister = VectorSetFloat1(static_cast<double>(Alpha));
+
+		Interpolation::ForEachValue(Positions.Num() * 3,
+			[&](const int32 ValueIndex)
+			{
+				const VectorRegister4Double FromRegister = VectorLoad(FromValues + ValueIndex);
+				const VectorRegister4Double ToRegister = VectorLoad(ToValues + ValueIndex);
+				VectorStore(VectorMultiplyAdd(VectorSubtract(ToRegister, FromRegister), AlphaRegister, FromRegister), Values + ValueIndex);
+			},
+			[&](const int32 ValueIndex)
+			{
+				Values[ValueIndex] = FromValues[ValueIndex] + (ToValues[ValueIndex] - FromValues[ValueIndex]) * Alpha;
+			});
+	}
+
+	void IntegrateVelocities(const TArrayView<FVector> Positions, const TArrayView<const FVector> Velocities, const float DeltaTime)
+	{
+		check(Velocities.Num() == Positions.Num());
+
+		if (Positions.Num() == 0)
+		{
+			return;
+		}
+
+		const double* VelocitiesValues = &Velocities[0].X;
+		double* Values = &Positions[0].X;
+		const VectorRegister4Double DeltaTimeRegister = VectorSetFloat1(static_cast<double>(DeltaTime));
+
+		Interpolation::ForEachValue(Positions.Num() * 3,
+			[&](const int32 ValueIndex)
+			{
+				VectorStore(VectorMultiplyAdd(VectorLoad(VelocitiesValues + ValueIndex), DeltaTimeRegister, VectorLoad(Values + ValueIndex)), Values + ValueIndex);
+			},
+			[&](const int32 ValueIndex)
+			{
+				Values[ValueIndex] += VelocitiesValues[ValueIndex] * DeltaTime;
+			});
+	}
+
+	bool IsInterpolationWithinError(const TArrayView<const FVector> From, const TArrayView<const FVector> To, const TArrayView<const FVector> Positions, const float Alpha, const double MaxError)
+	{
+		if (From.Num() != Positions.Num() || To.Num() != Positions.Num())
+		{
+			return false;
+		}
+
+		const VectorRegister4Double AlphaRegister = VectorSetFloat1(static_cast<double>(Alpha));
+		const VectorRegister4Double MaxErrorSquaredRegister = VectorSetFloat1(MaxError * MaxError);
+
+		// chunks of vertices are checked in parallel, all of them stop as soon as one vertex is out of bounds
+		std::atomic<bool> bWithinError = true;
+		ParallelFor(FMath::DivideAndRoundUp(Positions.Num(), Interpolation::ChunkSize), [&](const int32 ChunkIndex)
+			{
+				const int32 LastVertexIndex = FMath::Min((ChunkIndex + 1) * Interpolation::ChunkSize, Positions.Num());
+				for (int32 VertexIndex = ChunkIndex * Interpolation::ChunkSize; VertexIndex < LastVertexIndex && bWithinError.load(std::memory_order_relaxed); VertexIndex++)
+				{
+					const VectorRegister4Double FromRegister = VectorLoadFloat3(&From[VertexIndex].X);
+					const VectorRegister4Double ToRegister = VectorLoadFloat3(&To[VertexIndex].X);
+					const VectorRegister4Double Delta = VectorSubtract(VectorMultiplyAdd(VectorSubtract(ToRegister, FromRegister), AlphaRegister, FromRegister), VectorLoadFloat3(&Positions[VertexIndex].X));
+					if (VectorAnyGreaterThan(VectorDot3(Delta, Delta), MaxErrorSquaredRegister))
+					{
+						bWithinError = false;
+						return;
+					}
+				}
+			});
+
+		return bWithinError;
+	}
+
+	bool InterpolatePositions(const FObject& Object, const uint32 SampleIndex, const float Alpha, const float SampleDuration, TArray<FVector>& Positions)
+	{
+		if (Alpha <= 0)
+		{
+			return false;
+		}
+
+		uint32 TrueSampleIndex;
+
+		// velocities work even when the topology changes between samples (like in fluid simulations)
+		TSharedPtr<FArrayProperty> VelocitiesProperty = Object.FindArrayProperty(".geom/.velocities");
+		if (VelocitiesProperty && VelocitiesProperty->GetSampleTrueIndex(SampleIndex, TrueSampleIndex))
+		{
+			TArray<FVector> Velocities;
+			if (VelocitiesProperty->Get(TrueSampleIndex, Velocities) && Velocities.Num() == Positions.Num())
+			{
+				IntegrateVelocities(Positions, Velocities, Alpha * SampleDuration);
+				return true;
+			}
+		}
+
+		// blending requires the next sample to have the same topology (same sample or same content)
+		auto IsConstant = [&Object, SampleIndex](const FString& PropertyPath)
+			{
+				TSharedPtr<FArrayProperty> Property = Object.FindArrayProperty(PropertyPath);
+				uint32 CurrentTrueSampleIndex;
+				uint32 NextTrueSampleIndex;
+				if (!Property || !Property->GetSampleTrueIndex(SampleIndex, CurrentTrueSampleIndex) || !Property->GetSampleTrueIndex(SampleIndex + 1, NextTrueSampleIndex))
+				{
+					return false;
+				}
+
+				if (CurrentTrueSampleIndex == NextTrueSampleIndex)
+				{
+					return true;
+				}
+
+				FSampleDigest CurrentDigest;
+				FSampleDigest NextDigest;
+				return Property->GetDigest(CurrentTrueSampleIndex, CurrentDigest) && Property->GetDigest(NextTrueSampleIndex, NextDigest) && CurrentDigest == NextDigest;
+			};
+
+		if (!IsConstant(".geom/.faceIndices") || !IsConstant(".geom/.faceCounts"))
+		{
+			return false;
+		}
+
+		TSharedPtr<FArrayProperty> PositionsProperty = Object.FindArrayProperty(".geom/P");
+		if (!PositionsProperty || !PositionsProperty->GetSampleTrueIndex(SampleIndex + 1, TrueSampleIndex))
+		{
+			return false;
+		}
+
+		TArray<FVector> NextPositions;
+		if (!PositionsProperty->Get(TrueSampleIndex, NextPositions) || NextPositions.Num() != Positions.Num())
+		{
+			return false;
+		}
+
+		LerpPositions(Positions, NextPositions, Alpha, Positions);
+
+		return true;
+	}
+
+	void BuildMeshSections(FMeshTopology& Topology, const TArray<FFaceSet>& FaceSets)
+	{
+		const int32 NumTriangles = Topology.TriangleFaces.Num();
+		const int32 NumFaces = NumTriangles > 0 ? static_cast<int32>(Topology.TriangleFaces.Last()) + 1 : 0;
+
+		// the first face set claiming a face wins, the extra bucket collects the unassigned faces
+		const int32 UnassignedBucket = FaceSets.Num();
+		TArray<int32> FaceBuckets;
+		FaceBuckets.Init(UnassignedBucket, NumFaces);
+		for (int32 FaceSetIndex = FaceSets.Num() - 1; FaceSetIndex >= 0; FaceSetIndex--)
+		{
+			for (const int32 FaceIndex : FaceSets[FaceSetIndex].Faces)
+			{
+				if (FaceBuckets.IsValidIndex(FaceIndex))
+				{
+					FaceBuckets[FaceIndex] = FaceSetIndex;
+				}
+			}
+		}
+
+		// stable counting sort of the triangles by bucket
+		TArray<int32> BucketOffsets;
+		BucketOffsets.AddZeroed(UnassignedBucket + 2);
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			BucketOffsets[FaceBuckets[Topology.TriangleFaces[TriangleIndex]] + 1]++;
+		}
+
+		for (int32 BucketIndex = 0; BucketIndex <= UnassignedBucket; BucketIndex++)
+		{
+			BucketOffsets[BucketIndex + 1] += BucketOffsets[BucketIndex];
+		}
+
+		TArray<int32> SortedTriangles;
+		SortedTriangles.AddUninitialized(NumTriangles);
+		{
+			TArray<int32> Cursors(BucketOffsets.GetData(), UnassignedBucket + 1);
+			for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+			{
+				SortedTriangles[Cursors[FaceBuckets[Topology.TriangleFaces[TriangleIndex]]]++] = TriangleIndex;
+			}
+		}
+
+		const TArray<uint32>& VertexIndices = Topology.GetVertexIndices();
+
+		// section vertices are compacted, vertices are duplicated only when shared by different sections
+		TArray<int32> VertexStamps;
+		TArray<uint32> VertexRemap;
+		VertexStamps.Init(INDEX_NONE, Topology.NumVertices());
+		VertexRemap.AddUninitialized(Topology.NumVertices());
+
+		Topology.Sections.Reset();
+
+		for (int32 BucketIndex = 0; BucketIndex <= UnassignedBucket; BucketIndex++)
+		{
+			if (BucketOffsets[BucketIndex] == BucketOffsets[BucketIndex + 1])
+			{
+				continue;
+			}
+
+			FMeshSection& Section = Topology.Sections.AddDefaulted_GetRef();
+			if (BucketIndex < UnassignedBucket)
+			{
+				Section.Name = FaceSets[BucketIndex].Name;
+				Section.FaceSetIndex = BucketIndex;
+			}
+
+			Section.Indices.Reserve((BucketOffsets[BucketIndex + 1] - BucketOffsets[BucketIndex]) * 3);
+
+			for (int32 SortedIndex = BucketOffsets[BucketIndex]; SortedIndex < BucketOffsets[BucketIndex + 1]; SortedIndex++)
+			{
+				const int32 TriangleIndex = SortedTriangles[SortedIndex];
+				for (int32 Corner = 0; Corner < 3; Corner++)
+				{
+					const uint32 VertexIndex = VertexIndices[TriangleIndex * 3 + Corner];
+					if (VertexStamps[VertexIndex] != BucketIndex)
+					{
+						VertexStamps[VertexIndex] = BucketIndex;
+						VertexRemap[VertexIndex] = Section.Vertices.Add(VertexIndex);
+					}
+					Section.Indices.Add(VertexRemap[VertexIndex]);
+				}
+			}
+		}
+	}
+
+	FVertexCacheStats SimulateVertexCache(const TArrayView<const uint32> Indices, const int32 NumVertices, const int32 CacheSize)
+	{
+		FVertexCacheStats Stats;
+		Stats.NumTriangles = Indices.Num() / 3;
+
+		// a vertex is in the FIFO if it has been pushed less than CacheSize pushes ago
+		TArray<int32> VertexTimestamps;
+		VertexTimestamps.Init(INDEX_NONE, NumVertices);
+		int32 Timestamp = 0;
+
+		for (const uint32 Index : Indices)
+		{
+			if (Index >= static_cast<uint32>(NumVertices))
+			{
+				continue;
+			}
+
+			if (VertexTimestamps[Index] == INDEX_NONE)
+			{
+				Stats.NumVertices++;
+			}
+
+			if (VertexTimestamps[Index] == INDEX_NONE || Timestamp - VertexTimestamps[Index] >= CacheSize)
+			{
+				VertexTimestamps[Index] = Timestamp++;
+				Stats.NumTransforms++;
+			}
+		}
+
+		return Stats;
+	}
+
+	namespace VertexCache
+	{
+		constexpr int32 MaxSize = 32;
+		constexpr float DecayPower = 1.5f;
+		constexpr float LastTriangleScore = 0.75f;
+		constexpr float ValenceBoostScale = 2.0f;
+		constexpr float ValenceBoostPower = 0.5f;
+
+		float ComputeVertexScore(const int32 CachePosition, const int32 RemainingValence)
+		{
+			// no triangles left using this vertex
+			if (RemainingValence <= 0)
+			{
+				return -1.0f;
+			}
+
+			float Score = 0;
+			if (CachePosition >= 0)
+			{
+				if (CachePosition < 3)
+				{
+					// vertices of the last triangle get a fixed score, so that strips are not favoured over fans
+					Score = LastTriangleScore;
+				}
+				else
+				{
+					const float Scaler = 1.0f / (MaxSize - 3);
+					Score = FMath::Pow(1.0f - (CachePosition - 3) * Scaler, DecayPower);
+				}
+			}
+
+			// boost vertices with few triangles left, to get rid of them quickly
+			Score += ValenceBoostScale * FMath::Pow(static_cast<float>(RemainingValence), -ValenceBoostPower);
+
+			return Score;
+		}
+	}
+
+	bool OptimizeVertexCache(TArray<uint32>& Indices, const int32 NumVertices)
+	{
+		const int32 NumTriangles = Indices.Num() / 3;
+		if (NumTriangles == 0)
+		{
+			return true;
+		}
+
+		FVertexTriangleAdjacency Adjacency;
+		if (!Adjacency.Build(Indices, NumVertices))
+		{
+			return false;
+		}
+
+		TArray<int32> RemainingValences;
+		TArray<int32> CachePositions;
+		TArray<float> VertexScores;
+		RemainingValences.AddUninitialized(NumVertices);
+		CachePositions.Init(INDEX_NONE, NumVertices);
+		VertexScores.AddUninitialized(NumVertices);
+
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices; VertexIndex++)
+		{
+			RemainingValences[VertexIndex] = Adjacency.GetTriangles(VertexIndex).Num();
+			VertexScores[VertexIndex] = VertexCache::ComputeVertexScore(INDEX_NONE, RemainingValences[VertexIndex]);
+		}
+
+		TArray<float> TriangleScores;
+		TArray<bool> AddedTriangles;
+		TriangleScores.AddUninitialized(NumTriangles);
+		AddedTriangles.AddZeroed(NumTriangles);
+
+		int32 BestTriangle = INDEX_NONE;
+		float BestScore = -1;
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			TriangleScores[TriangleIndex] = VertexScores[Indices[TriangleIndex * 3]] + VertexScores[Indices[TriangleIndex * 3 + 1]] + VertexScores[Indices[TriangleIndex * 3 + 2]];
+			if (TriangleScores[TriangleIndex] > BestScore)
+			{
+				BestScore = TriangleScores[TriangleIndex];
+				BestTriangle = TriangleIndex;
+			}
+		}
+
+		TArray<uint32> NewIndices;
+		NewIndices.Reserve(Indices.Num());
+
+		TArray<uint32, TInlineAllocator<VertexCache::MaxSize + 3>> Cache;
+		TArray<uint32, TInlineAllocator<VertexCache::MaxSize + 3>> NewCache;
+
+		int32 ScanCursor = 0;
+
+		for (int32 OutputTriangle = 0; OutputTriangle < NumTriangles; OutputTriangle++)
+		{
+			// nothing good in the cache, fallback to the next triangle in the original order
+			if (BestTriangle == INDEX_NONE)
+			{
+				while (AddedTriangles[ScanCursor])
+				{
+					ScanCursor++;
+				}
+				BestTriangle = ScanCursor;
+			}
+
+			AddedTriangles[BestTriangle] = true;
+
+			const uint32 Corners[3] = { Indices[BestTriangle * 3], Indices[BestTriangle * 3 + 1], Indices[BestTriangle * 3 + 2] };
+
+			NewCache.Reset();
+			for (const uint32 Corner : Corners)
+			{
+				NewIndices.Add(Corner);
+				RemainingValences[Corner]--;
+				NewCache.AddUnique(Corner);
+			}
+
+			for (const uint32 CachedVertex : Cache)
+			{
+				if (!NewCache.Contains(CachedVertex))
+				{
+					NewCache.Add(CachedVertex);
+				}
+			}
+
+			// update cache positions (evicted vertices are at the tail of NewCache)
+			for (int32 CacheIndex = 0; CacheIndex < NewCache.Num(); CacheIndex++)
+			{
+				const uint32 VertexIndex = NewCache[CacheIndex];
+				CachePositions[VertexIndex] = CacheIndex < VertexCache::MaxSize ? CacheIndex : INDEX_NONE;
+				VertexScores[VertexIndex] = VertexCache::ComputeVertexScore(CachePositions[VertexIndex], RemainingValences[VertexIndex]);
+			}
+
+			// rescore the triangles touching the updated vertices and pick the next one
+			BestTriangle = INDEX_NONE;
+			BestScore = -1;
+			for (const uint32 VertexIndex : NewCache)
+			{
+				for (const uint32 TriangleIndex : Adjacency.GetTriangles(VertexIndex))
+				{
+					if (AddedTriangles[TriangleIndex])
+					{
+						continue;
+					}
+
+					TriangleScores[TriangleIndex] = VertexScores[Indices[TriangleIndex * 3]] + VertexScores[Indices[TriangleIndex * 3 + 1]] + VertexScores[Indices[TriangleIndex * 3 + 2]];
+					if (TriangleScores[TriangleIndex] > BestScore)
+					{
+						BestScore = TriangleScores[TriangleIndex];
+						BestTriangle = TriangleIndex;
+					}
+				}
+			}
+
+			if (NewCache.Num() > VertexCache::MaxSize)
+			{
+				NewCache.SetNum(VertexCache::MaxSize, EAllowShrinking::No);
+			}
+
+			Swap(Cache, NewCache);
+		}
+
+		Indices = MoveTemp(NewIndices);
+
+		return true;
+	}
+
+	void OptimizeVertexFetch(TArray<uint32>& Indices, TArray<uint32>& Vertices)
+	{
+		TArray<int32> Remap;
+		Remap.Init(INDEX_NONE, Vertices.Num());
+
+		TArray<uint32> NewVertices;
+		NewVertices.Reserve(Vertices.Num());
+
+		for (uint32& Index : Indices)
+		{
+			if (Remap[Index] == INDEX_NONE)
+			{
+				Remap[Index] = NewVertices.Add(Vertices[Index]);
+			}
+			Index = Remap[Index];
+		}
+
+		Vertices = MoveTemp(NewVertices);
+	}
+
+	void OptimizeMeshTopology(FMeshTopology& Topology)
+	{
+		if (Topology.Sections.Num() == 0)
+		{
+			BuildMeshSections(Topology, {});
+		}
+
+		TArray<FVertexCacheStats> Before;
+		TArray<FVertexCacheStats> After;
+		Before.AddDefaulted(Topology.Sections.Num());
+		After.AddDefaulted(Topology.Sections.Num());
+
+		ParallelFor(Topology.Sections.Num(), [&](const int32 SectionIndex)
+			{
+				FMeshSection& Section = Topology.Sections[SectionIndex];
+				Before[SectionIndex] = SimulateVertexCache(Section.Indices, Section.Vertices.Num());
+				if (OptimizeVertexCache(Section.Indices, Section.Vertices.Num()))
+				{
+					OptimizeVertexFetch(Section.Indices, Section.Vertices);
+				}
+				After[SectionIndex] = SimulateVertexCache(Section.Indices, Section.Vertices.Num());
+			});
+
+		FVertexCacheStats TotalBefore;
+		FVertexCacheStats TotalAfter;
+		Topology.VertexCacheMetrics.bFits16BitIndices = true;
+		for (int32 SectionIndex = 0; SectionIndex < Topology.Sections.Num(); SectionIndex++)
+		{
+			TotalBefore.NumTriangles += Before[SectionIndex].NumTriangles;
+			TotalBefore.NumVertices += Before[SectionIndex].NumVertices;
+			TotalBefore.NumTransforms += Before[SectionIndex].NumTransforms;
+			TotalAfter.NumTriangles += After[SectionIndex].NumTriangles;
+			TotalAfter.NumVertices += After[SectionIndex].NumVertices;
+			TotalAfter.NumTransforms += After[SectionIndex].NumTransforms;
+			if (Topology.Sections[SectionIndex].Vertices.Num() > MAX_uint16 + 1)
+			{
+				Topology.VertexCacheMetrics.bFits16BitIndices = false;
+			}
+		}
+
+		Topology.VertexCacheMetrics.ACMRBefore = TotalBefore.GetACMR();
+		Topology.VertexCacheMetrics.ATVRBefore = TotalBefore.GetATVR();
+		Topology.VertexCacheMetrics.ACMRAfter = TotalAfter.GetACMR();
+		Topology.VertexCacheMetrics.ATVRAfter = TotalAfter.GetATVR();
+		Topology.bVertexCacheOptimized = true;
+	}
+
+	namespace Simplification
+	{
+		// symmetric 4x4 plane quadric (only the upper triangle is stored)
+		struct FQuadric
+		{
+			double XX = 0;
+			double XY = 0;
+			double XZ = 0;
+			double XW = 0;
+			double YY = 0;
+			double YZ = 0;
+			double YW = 0;
+			double ZZ = 0;
+			double ZW = 0;
+			double WW = 0;
+
+			FQuadric() = default;
+
+			FQuadric(const FVector& Normal, const double Distance, const double Weight)
+			{
+				XX = Weight * Normal.X * Normal.X;
+				XY = Weight * Normal.X * Normal.Y;
+				XZ = Weight * Normal.X * Normal.Z;
+				XW = Weight * Normal.X * Distance;
+				YY = Weight * Normal.Y * Normal.Y;
+				YZ = Weight * Normal.Y * Normal.Z;
+				YW = Weight * Normal.Y * Distance;
+				ZZ = Weight * Normal.Z * Normal.Z;
+				ZW = Weight * Normal.Z * Distance;
+				WW = Weight * Distance * Distance;
+			}
+
+			FQuadric& operator+=(const FQuadric& Other)
+			{
+				XX += Other.XX;
+				XY += Other.XY;
+				XZ += Other.XZ;
+				XW += Other.XW;
+				YY += Other.YY;
+				YZ += Other.YZ;
+				YW += Other.YW;
+				ZZ += Other.ZZ;
+				ZW += Other.ZW;
+				WW += Other.WW;
+				return *this;
+			}
+
+			double Evaluate(const FVector& P) const
+			{
+				return XX * P.X * P.X + 2 * XY * P.X * P.Y + 2 * XZ * P.X * P.Z + 2 * XW * P.X +
+					YY * P.Y * P.Y + 2 * YZ * P.Y * P.Z + 2 * YW * P.Y +
+					ZZ * P.Z * P.Z + 2 * ZW * P.Z +
+					WW;
+			}
+		};
+
+		// From is merged into To, the versions invalidate the candidates computed before a neighbour collapse
+		struct FCollapse
+		{
+			double Cost;
+			uint32 From;
+			uint32 To;
+			uint32 FromVersion;
+			uint32 ToVersion;
+
+			bool operator<(const FCollapse& Other) const
+			{
+				return Cost < Other.Cost;
+			}
+		};
+
+		// open borders are kept in place by planes perpendicular to the border triangles
+		constexpr double BoundaryWeight = 100;
+		// collapses rotating a triangle normal by more than ~78 degrees are rejected
+		constexpr double MinNormalDot = 0.2;
+
+		FORCEINLINE uint64 GetEdgeKey(const uint32 A, const uint32 B)
+		{
+			return A < B ? (static_cast<uint64>(A) << 32) | B : (static_cast<uint64>(B) << 32) | A;
+		}
+	}
+
+	bool SimplifyMesh(const TArrayView<const FVector> Positions, const TArrayView<const uint32> Indices, const TArrayView<const bool> LockedVertices, const int32 TargetNumTriangles, TArray<uint32>& OutIndices)
+	{
+		using namespace Simplification;
+
+		const int32 NumVertices = Positions.Num();
+		const int32 NumTriangles = Indices.Num() / 3;
+
+		if (Indices.Num() % 3 != 0 || (LockedVertices.Num() > 0 && LockedVertices.Num() != NumVertices))
+		{
+			return false;
+		}
+
+		for (const uint32 Index : Indices)
+		{
+			if (Index >= static_cast<uint32>(NumVertices))
+			{
+				return false;
+			}
+		}
+
+		TArray<uint32> Triangles(Indices.GetData(), Indices.Num());
+		TArray<bool> RemovedTriangles;
+		RemovedTriangles.AddZeroed(NumTriangles);
+		TArray<bool> RemovedVertices;
+		RemovedVertices.AddZeroed(NumVertices);
+
+		TArray<TArray<uint32, TInlineAllocator<8>>> VertexTriangles;
+		VertexTriangles.SetNum(NumVertices);
+		TArray<FQuadric> Quadrics;
+		Quadrics.SetNum(NumVertices);
+		TArray<FVector> TriangleNormals;
+		TriangleNormals.AddUninitialized(NumTriangles);
+		TMap<uint64, int32> EdgeTriangles;
+		EdgeTriangles.Reserve(Indices.Num());
+
+		// area weighted face quadrics
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			const uint32* Corners = &Triangles[TriangleIndex * 3];
+			const FVector& A = Positions[Corners[0]];
+
+			FVector Normal = FVector::CrossProduct(Positions[Corners[1]] - A, Positions[Corners[2]] - A);
+			const double Length = Normal.Size();
+			TriangleNormals[TriangleIndex] = FVector::ZeroVector;
+			if (Length > UE_SMALL_NUMBER)
+			{
+				Normal /= Length;
+				TriangleNormals[TriangleIndex] = Normal;
+				const FQuadric Quadric(Normal, -FVector::DotProduct(Normal, A), Length * 0.5);
+				for (int32 Corner = 0; Corner < 3; Corner++)
+				{
+					Quadrics[Corners[Corner]] += Quadric;
+				}
+			}
+
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				VertexTriangles[Corners[Corner]].Add(TriangleIndex);
+				EdgeTriangles.FindOrAdd(GetEdgeKey(Corners[Corner], Corners[(Corner + 1) % 3]))++;
+			}
+		}
+
+		// border edges (used by a single triangle) quadrics
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			const uint32* Corners = &Triangles[TriangleIndex * 3];
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const uint32 A = Corners[Corner];
+				const uint32 B = Corners[(Corner + 1) % 3];
+				if (EdgeTriangles.FindChecked(GetEdgeKey(A, B)) != 1)
+				{
+					continue;
+				}
+
+				const FVector Edge = Positions[B] - Positions[A];
+				const FVector BorderNormal = FVector::CrossProduct(Edge, TriangleNormals[TriangleIndex]).GetSafeNormal();
+				if (BorderNormal.IsNearlyZero())
+				{
+					continue;
+				}
+
+				const FQuadric Quadric(BorderNormal, -FVector::DotProduct(BorderNormal, Positions[A]), BoundaryWeight * Edge.SizeSquared());
+				Quadrics[A] += Quadric;
+				Quadrics[B] += Quadric;
+			}
+		}
+
+		TArray<uint32> Versions;
+		Versions.AddZeroed(NumVertices);
+
+		TArray<FCollapse> Heap;
+		Heap.Reserve(EdgeTriangles.Num() * 2);
+
+		auto PushCollapse = [&](const uint32 From, const uint32 To)
+			{
+				if (LockedVertices.Num() > 0 && LockedVertices[From])
+				{
+					return;
+				}
+
+				FQuadric Quadric = Quadrics[From];
+				Quadric += Quadrics[To];
+				Heap.HeapPush(FCollapse{ Quadric.Evaluate(Positions[To]), From, To, Versions[From], Versions[To] });
+			};
+
+		for (const TPair<uint64, int32>& Pair : EdgeTriangles)
+		{
+			const uint32 A = static_cast<uint32>(Pair.Key >> 32);
+			const uint32 B = static_cast<uint32>(Pair.Key & 0xFFFFFFFF);
+			PushCollapse(A, B);
+			PushCollapse(B, A);
+		}
+
+		int32 NumLiveTriangles = NumTriangles;
+		TArray<uint32, TInlineAllocator<32>> Neighbours;
+		TArray<uint32, TInlineAllocator<32>> FromRing;
+		TArray<uint32, TInlineAllocator<32>> ToRing;
+
+		// sorted unique neighbours of a vertex, returns true if the vertex is on a border (a neighbour seen by a single triangle)
+		auto GatherRing = [&](const uint32 Vertex, TArray<uint32, TInlineAllocator<32>>& Ring)
+			{
+				Ring.Reset();
+				for (const uint32 TriangleIndex : VertexTriangles[Vertex])
+				{
+					if (RemovedTriangles[TriangleIndex])
+					{
+						continue;
+					}
+
+					for (int32 Corner = 0; Corner < 3; Corner++)
+					{
+						const uint32 Neighbour = Triangles[TriangleIndex * 3 + Corner];
+						if (Neighbour != Vertex)
+						{
+							Ring.Add(Neighbour);
+						}
+					}
+				}
+
+				Ring.Sort();
+
+				bool bBorder = false;
+				int32 NumUnique = 0;
+				for (int32 RingIndex = 0; RingIndex < Ring.Num();)
+				{
+					int32 NextRingIndex = RingIndex + 1;
+					while (NextRingIndex < Ring.Num() && Ring[NextRingIndex] == Ring[RingIndex])
+					{
+						NextRingIndex++;
+					}
+					bBorder |= NextRingIndex - RingIndex == 1;
+					Ring[NumUnique++] = Ring[RingIndex];
+					RingIndex = NextRingIndex;
+				}
+				Ring.SetNum(NumUnique, EAllowShrinking::No);
+
+				return bBorder;
+			};
+
+		while (NumLiveTriangles > TargetNumTriangles && Heap.Num() > 0)
+		{
+			FCollapse Collapse;
+			Heap.HeapPop(Collapse, EAllowShrinking::No);
+
+			const uint32 From = Collapse.From;
+			const uint32 To = Collapse.To;
+
+			if (RemovedVertices[From] || RemovedVertices[To] || Versions[From] != Collapse.FromVersion || Versions[To] != Collapse.ToVersion)
+			{
+				continue;
+			}
+
+			// the surviving triangles around From must not flip
+			int32 NumEdgeTriangles = 0;
+			bool bFlips = false;
+			for (const uint32 TriangleIndex : VertexTriangles[From])
+			{
+				if (RemovedTriangles[TriangleIndex])
+				{
+					continue;
+				}
+
+				const uint32* Corners = &Triangles[TriangleIndex * 3];
+				if (Corners[0] == To || Corners[1] == To || Corners[2] == To)
+				{
+					NumEdgeTriangles++;
+					continue;
+				}
+
+				FVector NewCorners[3];
+				for (int32 Corner = 0; Corner < 3; Corner++)
+				{
+					NewCorners[Corner] = Positions[Corners[Corner] == From ? To : Corners[Corner]];
+				}
+
+				const FVector OldNormal = FVector::CrossProduct(Positions[Corners[1]] - Positions[Corners[0]], Positions[Corners[2]] - Positions[Corners[0]]).GetSafeNormal();
+				const FVector NewNormal = FVector::CrossProduct(NewCorners[1] - NewCorners[0], NewCorners[2] - NewCorners[0]).GetSafeNormal();
+				if (FVector::DotProduct(OldNormal, NewNormal) < MinNormalDot)
+				{
+					bFlips = true;
+					break;
+				}
+			}
+
+			if (NumEdgeTriangles == 0 || bFlips)
+			{
+				continue;
+			}
+
+			// link condition: the only vertices shared by the rings of From and To are the opposite corners of the triangles on the edge,
+			// and an inner edge must not join two border vertices, otherwise the collapse pinches the surface into non-manifold edges or folded faces
+			const bool bFromBorder = GatherRing(From, FromRing);
+			const bool bToBorder = GatherRing(To, ToRing);
+			int32 NumSharedNeighbours = 0;
+			for (int32 FromRingIndex = 0, ToRingIndex = 0; FromRingIndex < FromRing.Num() && ToRingIndex < ToRing.Num();)
+			{
+				if (FromRing[FromRingIndex] < ToRing[ToRingIndex])
+				{
+					FromRingIndex++;
+				}
+				else if (FromRing[FromRingIndex] > ToRing[ToRingIndex])
+				{
+					ToRingIndex++;
+				}
+				else
+				{
+					NumSharedNeighbours++;
+					FromRingIndex++;
+					ToRingIndex++;
+				}
+			}
+
+			if (NumSharedNeighbours != NumEdgeTriangles || (NumEdgeTriangles > 1 && bFromBorder && bToBorder))
+			{
+				continue;
+			}
+
+			Quadrics[To] += Quadrics[From];
+			RemovedVertices[From] = true;
+			Versions[To]++;
+
+			for (const uint32 TriangleIndex : VertexTriangles[From])
+			{
+				if (RemovedTriangles[TriangleIndex])
+				{
+					continue;
+				}
+
+				uint32* Corners = &Triangles[TriangleIndex * 3];
+				if (Corners[0] == To || Corners[1] == To || Corners[2] == To)
+				{
+					RemovedTriangles[TriangleIndex] = true;
+					NumLiveTriangles--;
+					continue;
+				}
+
+				for (int32 Corner = 0; Corner < 3; Corner++)
+				{
+					if (Corners[Corner] == From)
+					{
+						Corners[Corner] = To;
+					}
+				}
+				VertexTriangles[To].Add(TriangleIndex);
+			}
+			VertexTriangles[From].Empty();
+
+			VertexTriangles[To].RemoveAllSwap([&](const uint32 TriangleIndex) { return RemovedTriangles[TriangleIndex]; });
+
+			// refresh the candidates around the merged vertex
+			Neighbours.Reset();
+			for (const uint32 TriangleIndex : VertexTriangles[To])
+			{
+				for (int32 Corner = 0; Corner < 3; Corner++)
+				{
+					const uint32 Neighbour = Triangles[TriangleIndex * 3 + Corner];
+					if (Neighbour != To)
+					{
+						Neighbours.AddUnique(Neighbour);
+					}
+				}
+			}
+
+			for (const uint32 Neighbour : Neighbours)
+			{
+				PushCollapse(To, Neighbour);
+				PushCollapse(Neighbour, To);
+			}
+		}
+
+		OutIndices.Reset(NumLiveTriangles * 3);
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			if (!RemovedTriangles[TriangleIndex])
+			{
+				OutIndices.Append(&Triangles[TriangleIndex * 3], 3);
+			}
+		}
+
+		return true;
+	}
+
+	bool BuildMeshLODs(FMeshTopology& Topology, const TArrayView<const FVector> Positions, const TArrayView<const float> TriangleRatios)
+	{
+		if (Positions.Num() != Topology.NumPositions)
+		{
+			return false;
+		}
+
+		if (Topology.Sections.Num() == 0)
+		{
+			BuildMeshSections(Topology, {});
+		}
+
+		// positions referenced by more than one section vertex (UV seams and section borders) must not move
+		TArray<int32> PositionReferences;
+		PositionReferences.AddZeroed(Topology.NumPositions);
+		for (const FMeshSection& Section : Topology.Sections)
+		{
+			for (const uint32 VertexIndex : Section.Vertices)
+			{
+				PositionReferences[Topology.GetVertexPosition(VertexIndex)]++;
+			}
+		}
+
+		const int32 NumSections = Topology.Sections.Num();
+
+		Topology.LODSections.SetNum(TriangleRatios.Num());
+		for (TArray<FMeshSection>& LODSections : Topology.LODSections)
+		{
+			LODSections.SetNum(NumSections);
+		}
+
+		TArray<bool> Results;
+		Results.AddZeroed(TriangleRatios.Num() * NumSections);
+
+		// every (LOD, section) pair is an independent job
+		ParallelFor(TriangleRatios.Num() * NumSections, [&](const int32 JobIndex)
+			{
+				const int32 LODIndex = JobIndex / NumSections;
+				const int32 SectionIndex = JobIndex % NumSections;
+
+				const FMeshSection& Section = Topology.Sections[SectionIndex];
+				FMeshSection& LODSection = Topology.LODSections[LODIndex][SectionIndex];
+
+				TArray<FVector> SectionPositions;
+				TArray<bool> LockedVertices;
+				SectionPositions.AddUninitialized(Section.Vertices.Num());
+				LockedVertices.AddUninitialized(Section.Vertices.Num());
+				for (int32 VertexIndex = 0; VertexIndex < Section.Vertices.Num(); VertexIndex++)
+				{
+					const uint32 PositionIndex = Topology.GetVertexPosition(Section.Vertices[VertexIndex]);
+					SectionPositions[VertexIndex] = Positions[PositionIndex];
+					LockedVertices[VertexIndex] = PositionReferences[PositionIndex] > 1;
+				}
+
+				const int32 TargetNumTriangles = FMath::FloorToInt32((Section.Indices.Num() / 3) * FMath::Clamp(TriangleRatios[LODIndex], 0.0f, 1.0f));
+
+				LODSection.Name = Section.Name;
+				LODSection.FaceSetIndex = Section.FaceSetIndex;
+				LODSection.Vertices = Section.Vertices;
+				if (!SimplifyMesh(SectionPositions, Section.Indices, LockedVertices, TargetNumTriangles, LODSection.Indices))
+				{
+					return;
+				}
+
+				if (Topology.bVertexCacheOptimized)
+				{
+					OptimizeVertexCache(LODSection.Indices, LODSection.Vertices.Num());
+				}
+
+				// drop the collapsed vertices
+				OptimizeVertexFetch(LODSection.Indices, LODSection.Vertices);
+
+				Results[JobIndex] = true;
+			});
+
+		if (Results.Contains(false))
+		{
+			Topology.LODSections.Empty();
+			return false;
+		}
+
+		return true;
+	}
+
+	FVector ComputeArbitraryTangent(const FVector& Normal)
+	{
+		FVector Arbitrary = FVector::RightVector;
+		if (FMath::Abs(FVector::DotProduct(Normal, Arbitrary)) > 0.99f)
+		{
+			Arbitrary = FVector::UpVector;
+		}
+
+		const FVector Tangent = Arbitrary - Normal * FVector::DotProduct(Arbitrary, Normal);
+		return Tangent.GetSafeNormal();
+	}
+
+	void ComputeSmoothNormals(const FMeshTopology& Topology, const TArrayView<const FVector> Positions, const EglTFRuntimeAlembicNormalsWeighting Weighting, TArray<FVector>& Normals, TArray<FVector4>& Tangents)
+	{
+		const int32 NumVertices = Topology.Adjacency.NumVertices();
+
+		Normals.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+		Tangents.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+
+		ParallelFor(NumVertices, [&](const int32 VertexIndex)
+			{
+				FVector Normal = FVector::ZeroVector;
+				for (const uint32 TriangleIndex : Topology.Adjacency.GetTriangles(VertexIndex))
+				{
+					const uint32* Corners = Topology.Indices.GetData() + TriangleIndex * 3;
+					const FVector& A = Positions[Corners[0]];
+					const FVector& B = Positions[Corners[1]];
+					const FVector& C = Positions[Corners[2]];
+
+					// Alembic winding is flipped during triangulation
+					const FVector FaceNormal = FVector::CrossProduct(C - A, B - A);
+
+					if (Weighting == EglTFRuntimeAlembicNormalsWeighting::Angle)
+					{
+						const uint32 Corner = Corners[0] == static_cast<uint32>(VertexIndex) ? 0 : (Corners[1] == static_cast<uint32>(VertexIndex) ? 1 : 2);
+						const FVector& Origin = Positions[Corners[Corner]];
+						const FVector EdgeA = (Positions[Corners[(Corner + 1) % 3]] - Origin).GetSafeNormal();
+						const FVector EdgeB = (Positions[Corners[(Corner + 2) % 3]] - Origin).GetSafeNormal();
+						const double Angle = FMath::Acos(FMath::Clamp(FVector::DotProduct(EdgeA, EdgeB), -1.0, 1.0));
+						Normal += FaceNormal.GetSafeNormal() * Angle;
+					}
+					else if (Weighting == EglTFRuntimeAlembicNormalsWeighting::Area)
+					{
+						// cross product length is twice the triangle area
+						Normal += FaceNormal;
+					}
+					else
+					{
+						Normal += FaceNormal.GetSafeNormal();
+					}
+				}
+
+				Normal.Normalize();
+				Normals[VertexIndex] = Normal;
+				Tangents[VertexIndex] = ComputeArbitraryTangent(Normal);
+			});
+	}
+
+	void ComputeFaceVaryingNormals(const FMeshTopology& Topology, const TArrayView<const FVector> FaceVaryingNormals, TArray<FVector>& Normals, TArray<FVector4>& Tangents)
+	{
+		const int32 NumVertices = Topology.Adjacency.NumVertices();
+
+		Normals.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+		Tangents.SetNumUninitialized(NumVertices, EAllowShrinking::No);
+
+		ParallelFor(NumVertices, [&](const int32 VertexIndex)
+			{
+				FVector Normal = FVector::ZeroVector;
+				for (const uint32 TriangleIndex : Topology.Adjacency.GetTriangles(VertexIndex))
+				{
+					for (uint32 Corner = 0; Corner < 3; Corner++)
+					{
+						if (Topology.Indices[TriangleIndex * 3 + Corner] == static_cast<uint32>(VertexIndex))
+						{
+							const uint32 FaceVertexIndex = Topology.FaceVertexIndices[TriangleIndex * 3 + Corner];
+							if (FaceVaryingNormals.IsValidIndex(FaceVertexIndex))
+							{
+								Normal += FaceVaryingNormals[FaceVertexIndex];
+							}
+						}
+					}
+				}
+
+				Normal.Normalize();
+				Normals[VertexIndex] = Normal;
+				Tangents[VertexIndex] = ComputeArbitraryTangent(Normal);
+			});
+	}
+
+	struct FMikkTSpaceMesh
+	{
+		TArrayView<const uint32> Indices;
+		TArrayView<const FVector> Positions;
+		TArrayView<const FVector> Normals;
+		TArrayView<const FVector2D> UVs;
+		TArray<FVector> Tangents;
+		TArray<float> Signs;
+
+		static FMikkTSpaceMesh& Get(const SMikkTSpaceContext* Context)
+		{
+			return *static_cast<FMikkTSpaceMesh*>(Context->m_pUserData);
+		}
+
+		static int GetNumFaces(const SMikkTSpaceContext* Context)
+		{
+			return Get(Context).Indices.Num() / 3;
+		}
+
+		static int GetNumVerticesOfFace(const SMikkTSpaceContext* Context, const int FaceIndex)
+		{
+			return 3;
+		}
+
+		static void GetPosition(const SMikkTSpaceContext* Context, float Position[], const int FaceIndex, const int VertexIndex)
+		{
+			const FVector& Value = Get(Context).Positions[Get(Context).Indices[FaceIndex * 3 + VertexIndex]];
+			Position[0] = Value.X;
+			Position[1] = Value.Y;
+			Position[2] = Value.Z;
+		}
+
+		static void GetNormal(const SMikkTSpaceContext* Context, float Normal[], const int FaceIndex, const int VertexIndex)
+		{
+			const FVector& Value = Get(Context).Normals[Get(Context).Indices[FaceIndex * 3 + VertexIndex]];
+			Normal[0] = Value.X;
+			Normal[1] = Value.Y;
+			Normal[2] = Value.Z;
+		}
+
+		static void GetTexCoord(const SMikkTSpaceContext* Context, float UV[], const int FaceIndex, const int VertexIndex)
+		{
+			const FVector2D& Value = Get(Context).UVs[Get(Context).Indices[FaceIndex * 3 + VertexIndex]];
+			UV[0] = Value.X;
+			UV[1] = Value.Y;
+		}
+
+		static void SetTSpaceBasic(const SMikkTSpaceContext* Context, const float Tangent[], const float Sign, const int FaceIndex, const int VertexIndex)
+		{
+			FMikkTSpaceMesh& Mesh = Get(Context);
+			const uint32 Index = Mesh.Indices[FaceIndex * 3 + VertexIndex];
+			// corners sharing a vertex are averaged
+			Mesh.Tangents[Index] += FVector(Tangent[0], Tangent[1], Tangent[2]);
+			Mesh.Signs[Index] = Sign;
+		}
+	};
+
+	bool ComputeMikkTSpaceTangents(const TArrayView<const uint32> Indices, const TArrayView<const FVector> Positions, const TArrayView<const FVector> Normals, const TArrayView<const FVector2D> UVs, TArray<FVector4>& Tangents)
+	{
+		if (Indices.Num() % 3 != 0 || Normals.Num() != Positions.Num() || UVs.Num() != Positions.Num())
+		{
+			return false;
+		}
+
+		for (const uint32 Index : Indices)
+		{
+			if (Index >= static_cast<uint32>(Positions.Num()))
+			{
+				return false;
+			}
+		}
+
+		FMikkTSpaceMesh Mesh;
+		Mesh.Indices = Indices;
+		Mesh.Positions = Positions;
+		Mesh.Normals = Normals;
+		Mesh.UVs = UVs;
+		Mesh.Tangents.AddZeroed(Positions.Num());
+		Mesh.Signs.Init(1, Positions.Num());
+
+		SMikkTSpaceInterface Interface;
+		FMemory::Memzero(Interface);
+		Interface.m_getNumFaces = FMikkTSpaceMesh::GetNumFaces;
+		Interface.m_getNumVerticesOfFace = FMikkTSpaceMesh::GetNumVerticesOfFace;
+		Interface.m_getPosition = FMikkTSpaceMesh::GetPosition;
+		Interface.m_getNormal = FMikkTSpaceMesh::GetNormal;
+		Interface.m_getTexCoord = FMikkTSpaceMesh::GetTexCoord;
+		Interface.m_setTSpaceBasic = FMikkTSpaceMesh::SetTSpaceBasic;
+
+		SMikkTSpaceContext Context;
+		Context.m_pInterface = &Interface;
+		Context.m_pUserData = &Mesh;
+
+		if (!genTangSpaceDefault(&Context))
+		{
+			return false;
+		}
+
+		Tangents.SetNumUninitialized(Positions.Num(), EAllowShrinking::No);
+		for (int32 VertexIndex = 0; VertexIndex < Positions.Num(); VertexIndex++)
+		{
+			FVector Tangent = Mesh.Tangents[VertexIndex].GetSafeNormal();
+			if (Tangent.IsNearlyZero())
+			{
+				Tangent = ComputeArbitraryTangent(Normals[VertexIndex]);
+			}
+			Tangents[VertexIndex] = FVector4(Tangent, Mesh.Signs[VertexIndex]);
+		}
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,626 @@
+// Copyright 2025 - Roberto De Ioris
+
+#include "glTFRuntimeABCXform.h"
+#include "Async/ParallelFor.h"
+#include <atomic>
+
+namespace glTFRuntimeAlembic
+{
+	FTransform FXformTrack::GetTransform(const int32 SampleIndex, const float Alpha) const
+	{
+		auto GetKeys = [SampleIndex](const int32 NumKeys, int32& KeyIndex, int32& NextKeyIndex)
+			{
+				KeyIndex = FMath::Clamp(SampleIndex, 0, NumKeys - 1);
+				NextKeyIndex = FMath::Min(KeyIndex + 1, NumKeys - 1);
+			};
+
+		FTransform Transform = FTransform::Identity;
+		int32 KeyIndex;
+		int32 NextKeyIndex;
+
+		if (Translations.Num() > 0)
+		{
+			GetKeys(Translations.Num(), KeyIndex, NextKeyIndex);
+			Transform.SetTranslation(FVector(Alpha > 0 ? FMath::Lerp(Translations[KeyIndex], Translations[NextKeyIndex], Alpha) : Translations[KeyIndex]));
+		}
+
+		if (Rotations.Num() > 0)
+		{
+			GetKeys(Rotations.Num(), KeyIndex, NextKeyIndex);
+			Transform.SetRotation(FQuat(Alpha > 0 ? FQuat4f::Slerp(Rotations[KeyIndex], Rotations[NextKeyIndex], Alpha) : Rotations[KeyIndex]));
+		}
+
+		if (Scales.Num() > 0)
+		{
+			GetKeys(Scales.Num(), KeyIndex, NextKeyIndex);
+			Transform.SetScale3D(FVector(Alpha > 0 ? FMath::Lerp(Scales[KeyIndex], Scales[NextKeyIndex], Alpha) : Scales[KeyIndex]));
+		}
+
+		return Transform;
+	}
+
+	void FXformTrack::CollapseConstantChannels(const float Tolerance)
+	{
+		auto Collapse = [Tolerance](auto& Keys)
+			{
+				for (int32 KeyIndex = 1; KeyIndex < Keys.Num(); KeyIndex++)
+				{
+					if (!Keys[KeyIndex].Equals(Keys[0], Tolerance))
+					{
+						return;
+					}
+				}
+
+				if (Keys.Num() > 1)
+				{
+					Keys.SetNum(1);
+				}
+			};
+
+		Collapse(Translations);
+		Collapse(Rotations);
+		Collapse(Scales);
+	}
+
+	bool BakeXformTrack(const FObject& Object, FXformTrack& Track)
+	{
+		Track = FXformTrack();
+
+		TSharedPtr<FScalarProperty> OpsProperty = Object.FindScalarProperty(".xform/.ops");
+		TSharedPtr<FScalarProperty> ValsProperty = Object.FindScalarProperty(".xform/.vals");
+		if (!OpsProperty || !ValsProperty)
+		{
+			return false;
+		}
+
+		Track.NumSamples = FMath::Max<int32>(OpsProperty->NextSampleIndex, ValsProperty->NextSampleIndex);
+		Track.Translations.Reserve(Track.NumSamples);
+		Track.Rotations.Reserve(Track.NumSamples);
+		Track.Scales.Reserve(Track.NumSamples);
+
+		uint32 PreviousOpsTrueSampleIndex = MAX_uint32;
+		uint32 PreviousValsTrueSampleIndex = MAX_uint32;
+		for (int32 SampleIndex = 0; SampleIndex < Track.NumSamples; SampleIndex++)
+		{
+			// the shortest property holds its last sample
+			uint32 OpsTrueSampleIndex;
+			uint32 ValsTrueSampleIndex;
+			if (!OpsProperty->GetSampleTrueIndex(FMath::Min<uint32>(SampleIndex, OpsProperty->NextSampleIndex - 1), OpsTrueSampleIndex) ||
+				!ValsProperty->GetSampleTrueIndex(FMath::Min<uint32>(SampleIndex, ValsProperty->NextSampleIndex - 1), ValsTrueSampleIndex))
+			{
+				return false;
+			}
+
+			if (OpsTrueSampleIndex == PreviousOpsTrueSampleIndex && ValsTrueSampleIndex == PreviousValsTrueSampleIndex)
+			{
+				Track.Translations.Add(Track.Translations.Last());
+				Track.Rotations.Add(Track.Rotations.Last());
+				Track.Scales.Add(Track.Scales.Last());
+				continue;
+			}
+
+			FTransform Transform;
+			if (!BuildTransform(OpsTrueSampleIndex, OpsProperty.ToSharedRef(), ValsTrueSampleIndex, ValsProperty.ToSharedRef(), Transform))
+			{
+				return false;
+			}
+
+			FQuat4f Rotation = FQuat4f(Transform.GetRotation());
+			// keep consecutive rotations in the same hemisphere so that blending takes the short path
+			if (Track.Rotations.Num() > 0 && (Track.Rotations.Last() | Rotation) < 0)
+			{
+				Rotation = FQuat4f(-Rotation.X, -Rotation.Y, -Rotation.Z, -Rotation.W);
+			}
+
+			Track.Translations.Add(FVector3f(Transform.GetTranslation()));
+			Track.Rotations.Add(Rotation);
+			Track.Scales.Add(FVector3f(Transform.GetScale3D()));
+
+			PreviousOpsTrueSampleIndex = OpsTrueSampleIndex;
+			PreviousValsTrueSampleIndex = ValsTrueSampleIndex;
+		}
+
+		Track.CollapseConstantChannels();
+
+		return true;
+	}
+
+	void BakeXformTracks(const FObject& Root, TMap<const FObject*, FXformTrack>& Tracks)
+	{
+		TArray<const FObject*> Objects = { &Root };
+		TArray<const FObject*> Xforms;
+		while (Objects.Num() > 0)
+		{
+			const FObject* Object = Objects.Pop(EAllowShrinking::No);
+			for (const TSharedRef<FObject>& Child : Object->Children)
+			{
+				Objects.Add(&Child.Get());
+			}
+
+			if (Object->FindScalarProperty(".xform/.ops") && Object->FindScalarProperty(".xform/.vals"))
+			{
+				Xforms.Add(Object);
+			}
+		}
+
+		TArray<FXformTrack> XformTracks;
+		TArray<bool> Results;
+		XformTracks.SetNum(Xforms.Num());
+		Results.Init(false, Xforms.Num());
+		ParallelFor(Xforms.Num(), [&](const int32 XformIndex)
+			{
+				Results[XformIndex] = BakeXformTrack(*Xforms[XformIndex], XformTracks[XformIndex]);
+			});
+
+		Tracks.Reset();
+		Tracks.Reserve(Xforms.Num());
+		for (int32 XformIndex = 0; XformIndex < Xforms.Num(); XformIndex++)
+		{
+			if (Results[XformIndex])
+			{
+				Tracks.Add(Xforms[XformIndex], MoveTemp(XformTracks[XformIndex]));
+			}
+		}
+	}
+
+	bool FVisibilityTrack::IsAlwaysHidden() const
+	{
+		return Samples.Num() > 0 && Samples.Find(true) == INDEX_NONE;
+	}
+
+	bool FVisibilityTrack::IsVisibleInRange(const int32 FirstSampleIndex, const int32 LastSampleIndex) const
+	{
+		if (Samples.Num() == 0)
+		{
+			return true;
+		}
+
+		const int32 FromSampleIndex = FMath::Clamp(FMath::Min(FirstSampleIndex, LastSampleIndex), 0, Samples.Num() - 1);
+		const int32 ToSampleIndex = FMath::Clamp(FMath::Max(FirstSampleIndex, LastSampleIndex), 0, Samples.Num() - 1);
+		for (int32 SampleIndex = FromSampleIndex; SampleIndex <= ToSampleIndex; SampleIndex++)
+		{
+			if (Samples[SampleIndex])
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool BakeVisibilityTrack(const FObject& Object, const FVisibilityTrack* ParentTrack, FVisibilityTrack& Track)
+	{
+		Track = FVisibilityTrack();
+
+		TSharedPtr<FScalarProperty> VisibleProperty = Object.Properties ? Object.FindScalarProperty("visible") : nullptr;
+		const int32 NumSamples = FMath::Max<int32>(VisibleProperty ? VisibleProperty->NextSampleIndex : 0, ParentTrack ? ParentTrack->NumSamples() : 0);
+		if (NumSamples <= 0)
+		{
+			return false;
+		}
+
+		Track.Samples.Init(true, NumSamples);
+
+		uint32 PreviousTrueSampleIndex = MAX_uint32;
+		int8 Visibility = -1;
+		bool bHasHiddenSamples = false;
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex++)
+		{
+			uint32 TrueSampleIndex;
+			if (VisibleProperty && VisibleProperty->GetSampleTrueIndex(FMath::Min<uint32>(SampleIndex, VisibleProperty->NextSampleIndex - 1), TrueSampleIndex) && TrueSampleIndex != PreviousTrueSampleIndex)
+			{
+				if (!VisibleProperty->Get(TrueSampleIndex, 0, Visibility))
+				{
+					Visibility = -1;
+				}
+				PreviousTrueSampleIndex = TrueSampleIndex;
+			}
+
+			if (Visibility == 0 || (ParentTrack && !ParentTrack->IsVisible(SampleIndex)))
+			{
+				Track.Samples[SampleIndex] = false;
+				bHasHiddenSamples = true;
+			}
+		}
+
+		if (!bHasHiddenSamples)
+		{
+			Track = FVisibilityTrack();
+			return false;
+		}
+
+		// constant visibility
+		if (Track.IsAlwaysHidden())
+		{
+			Track.Samples.Init(false, 1);
+		}
+
+		return true;
+	}
+
+	void BakeVisibilityTracks(const FObject& Root, TMap<const FObject*, FVisibilityTrack>& Tracks)
+	{
+		Tracks.Reset();
+
+		// objects with the index of the track of their closest hidden ancestor
+		TArray<TPair<const FObject*, int32>> Objects = { { &Root, INDEX_NONE } };
+		TArray<TPair<const FObject*, FVisibilityTrack>> VisibilityTracks;
+		while (Objects.Num() > 0)
+		{
+			const TPair<const FObject*, int32> Pair = Objects.Pop(EAllowShrinking::No);
+
+			int32 TrackIndex = Pair.Value;
+			FVisibilityTrack Track;
+			if (BakeVisibilityTrack(*Pair.Key, Pair.Value != INDEX_NONE ? &VisibilityTracks[Pair.Value].Value : nullptr, Track))
+			{
+				TrackIndex = VisibilityTracks.Emplace(Pair.Key, MoveTemp(Track));
+			}
+
+			for (const TSharedRef<FObject>& Child : Pair.Key->Children)
+			{
+				Objects.Emplace(&Child.Get(), TrackIndex);
+			}
+		}
+
+		Tracks.Reserve(VisibilityTracks.Num());
+		for (TPair<const FObject*, FVisibilityTrack>& Pair : VisibilityTracks)
+		{
+			Tracks.Add(Pair.Key, MoveTemp(Pair.Value));
+		}
+	}
+
+	namespace Xform
+	{
+		// the shortest properties hold their last sample
+		bool GetClampedSampleTrueIndex(const FScalarProperty& Property, const int32 SampleIndex, uint32& TrueSampleIndex)
+		{
+			if (Property.NextSampleIndex == 0)
+			{
+				return false;
+			}
+
+			return Property.GetSampleTrueIndex(FMath::Clamp<int32>(SampleIndex, 0, Property.NextSampleIndex - 1), TrueSampleIndex);
+		}
+	}
+
+	void FXformHierarchy::Build(const FObject& Root)
+	{
+		Objects.Reset();
+		ParentIndices.Reset();
+		LevelOffsets.Reset();
+		Xforms.Reset();
+		ObjectIndices.Reset();
+
+		Objects.Add(&Root);
+		ParentIndices.Add(INDEX_NONE);
+
+		int32 LevelStart = 0;
+		while (LevelStart < Objects.Num())
+		{
+			LevelOffsets.Add(LevelStart);
+			const int32 LevelEnd = Objects.Num();
+			for (int32 ObjectIndex = LevelStart; ObjectIndex < LevelEnd; ObjectIndex++)
+			{
+				for (const TSharedRef<FObject>& Child : Objects[ObjectIndex]->Children)
+				{
+					Objects.Add(&Child.Get());
+					ParentIndices.Add(ObjectIndex);
+				}
+			}
+			LevelStart = LevelEnd;
+		}
+		LevelOffsets.Add(Objects.Num());
+
+		Xforms.SetNum(Objects.Num());
+		ObjectIndices.Reserve(Objects.Num());
+		for (int32 ObjectIndex = 0; ObjectIndex < Objects.Num(); ObjectIndex++)
+		{
+			const FObject& Object = *Objects[ObjectIndex];
+			ObjectIndices.Add(&Object, ObjectIndex);
+
+			if (!Object.Properties)
+			{
+				continue;
+			}
+
+			FXformProperties& XformProperties = Xforms[ObjectIndex];
+			XformProperties.Ops = Object.FindScalarProperty(".xform/.ops");
+			XformProperties.Vals = Object.FindScalarProperty(".xform/.vals");
+			if (!XformProperties.Ops || !XformProperties.Vals)
+			{
+				XformProperties = FXformProperties();
+				continue;
+			}
+			XformProperties.Inherits = Object.FindScalarProperty(".xform/.inherits");
+		}
+	}
+
+	int32 FXformHierarchy::GetObjectIndex(const FObject& Object) const
+	{
+		const int32* ObjectIndex = ObjectIndices.Find(&Object);
+		return ObjectIndex ? *ObjectIndex : INDEX_NONE;
+	}
+
+	int32 FXformHierarchy::GetNumSamples() const
+	{
+		int32 NumSamples = 0;
+		for (const FXformProperties& XformProperties : Xforms)
+		{
+			if (XformProperties.Ops)
+			{
+				NumSamples = FMath::Max<int32>(NumSamples, FMath::Max(XformProperties.Ops->NextSampleIndex, XformProperties.Vals->NextSampleIndex));
+			}
+		}
+		return NumSamples;
+	}
+
+	bool FXformHierarchy::GetLocalMatrix(const int32 ObjectIndex, const int32 SampleIndex, const float Alpha, FMatrix& Matrix, bool& bInherits) const
+	{
+		Matrix = FMatrix::Identity;
+		bInherits = true;
+
+		const FXformProperties& XformProperties = Xforms[ObjectIndex];
+		if (!XformProperties.Ops)
+		{
+			return true;
+		}
+
+		uint32 TrueSampleIndex;
+		if (XformProperties.Inherits && Xform::GetClampedSampleTrueIndex(*XformProperties.Inherits, SampleIndex, TrueSampleIndex))
+		{
+			uint8 bInheritsAsUint8 = 1;
+			if (XformProperties.Inherits->Get(TrueSampleIndex, 0, bInheritsAsUint8))
+			{
+				bInherits = bInheritsAsUint8 != 0;
+			}
+		}
+
+		uint32 OpsTrueSampleIndex;
+		uint32 ValsTrueSampleIndex;
+		if (!Xform::GetClampedSampleTrueIndex(*XformProperties.Ops, SampleIndex, OpsTrueSampleIndex) || !Xform::GetClampedSampleTrueIndex(*XformProperties.Vals, SampleIndex, ValsTrueSampleIndex))
+		{
+			return false;
+		}
+
+		uint32 NextOpsTrueSampleIndex = OpsTrueSampleIndex;
+		uint32 NextValsTrueSampleIndex = ValsTrueSampleIndex;
+		if (Alpha > 0 && (!Xform::GetClampedSampleTrueIndex(*XformProperties.Ops, SampleIndex + 1, NextOpsTrueSampleIndex) || !Xform::GetClampedSampleTrueIndex(*XformProperties.Vals, SampleIndex + 1, NextValsTrueSampleIndex)))
+		{
+			return false;
+		}
+
+		// blending goes through TRS, a static xform keeps its exact matrix
+		if (NextOpsTrueSampleIndex != OpsTrueSampleIndex || NextValsTrueSampleIndex != ValsTrueSampleIndex)
+		{
+			FTransform Transform;
+			FTransform NextTransform;
+			if (!BuildTransform(OpsTrueSampleIndex, XformProperties.Ops.ToSharedRef(), ValsTrueSampleIndex, XformProperties.Vals.ToSharedRef(), Transform) ||
+				!BuildTransform(NextOpsTrueSampleIndex, XformProperties.Ops.ToSharedRef(), NextValsTrueSampleIndex, XformProperties.Vals.ToSharedRef(), NextTransform))
+			{
+				return false;
+			}
+
+			Transform.BlendWith(NextTransform, Alpha);
+			Matrix = Transform.ToMatrixWithScale();
+			return true;
+		}
+
+		if (!BuildMatrix(OpsTrueSampleIndex, XformProperties.Ops.ToSharedRef(), ValsTrueSampleIndex, XformProperties.Vals.ToSharedRef(), Matrix))
+		{
+			Matrix = FMatrix::Identity;
+			return false;
+		}
+
+		return true;
+	}
+
+	bool FXformHierarchy::EvaluateWorldMatrices(const int32 SampleIndex, TArray<FMatrix>& WorldMatrices, const float Alpha) const
+	{
+		WorldMatrices.SetNumUninitialized(Objects.Num(), EAllowShrinking::No);
+
+		TArray<bool> Inherits;
+		Inherits.SetNumUninitialized(Objects.Num());
+
+		std::atomic<bool> bSuccess = true;
+
+		// local matrices, the expensive part, are independent of each other
+		ParallelFor(Objects.Num(), [&](const int32 ObjectIndex)
+			{
+				bool bInherits = true;
+				if (!GetLocalMatrix(ObjectIndex, SampleIndex, Alpha, WorldMatrices[ObjectIndex], bInherits))
+				{
+					bSuccess = false;
+				}
+				Inherits[ObjectIndex] = bInherits;
+			});
+
+		// every level only depends on the previous one (the root level has no parent)
+		for (int32 LevelIndex = 1; LevelIndex < LevelOffsets.Num() - 1; LevelIndex++)
+		{
+			const int32 LevelStart = LevelOffsets[LevelIndex];
+			ParallelFor(LevelOffsets[LevelIndex + 1] - LevelStart, [&](const int32 LevelObjectIndex)
+				{
+					const int32 ObjectIndex = LevelStart + LevelObjectIndex;
+					if (Inherits[ObjectIndex])
+					{
+						WorldMatrices[ObjectIndex] = WorldMatrices[ObjectIndex] * WorldMatrices[ParentIndices[ObjectIndex]];
+					}
+				});
+		}
+
+		return bSuccess;
+	}
+
+	bool FXformHierarchy::EvaluateWorldMatrices(const float Time, const float FramesPerSecond, TArray<FMatrix>& WorldMatrices) const
+	{
+		const float Sample = FMath::Max(Time * FramesPerSecond, 0.0f);
+		const int32 SampleIndex = FMath::FloorToInt32(Sample);
+		return EvaluateWorldMatrices(SampleIndex, WorldMatrices, Sample - SampleIndex);
+	}
+
+	bool FRigidSkeleton::Build(const FObject& Root)
+	{
+		Bones.Reset();
+		Meshes.Reset();
+		AncestorsTracks.Reset();
+		AncestorsInherits.Reset();
+
+		// animated values are not supported, the first sample wins
+		auto GetInherits = [](const FObject& Object)
+			{
+				uint8 bInherits = 1;
+				if (Object.Properties)
+				{
+					if (TSharedPtr<FScalarProperty> InheritsProperty = Object.FindScalarProperty(".xform/.inherits"))
+					{
+						InheritsProperty->Get(0, 0, bInherits);
+					}
+				}
+				return bInherits != 0;
+			};
+
+		TSet<FString> BonesNames;
+		auto AddBone = [&](const FObject& Object, const int32 ParentIndex)
+			{
+				FString BoneName = Object.Name.IsEmpty() ? TEXT("root") : Object.Name;
+				for (int32 Suffix = 1; BonesNames.Contains(BoneName); Suffix++)
+				{
+					BoneName = FString::Printf(TEXT("%s_%d"), *Object.Name, Suffix);
+				}
+				BonesNames.Add(BoneName);
+
+				FBone& Bone = Bones.AddDefaulted_GetRef();
+				Bone.Object = &Object;
+				Bone.bInherits = GetInherits(Object);
+				// a non inheriting xform ignores the bones between it and the root
+				Bone.ParentIndex = Bone.bInherits || ParentIndex == INDEX_NONE ? ParentIndex : 0;
+				Bone.Name = BoneName;
+				return Bones.Num() - 1;
+			};
+
+		AddBone(Root, INDEX_NONE);
+
+		// bones are added while visiting their parent, so they always follow it
+		TArray<TPair<const FObject*, int32>> Objects = { TPair<const FObject*, int32>(&Root, 0) };
+		while (Objects.Num() > 0)
+		{
+			const TPair<const FObject*, int32> Pair = Objects.Pop(EAllowShrinking::No);
+
+			for (const TSharedRef<FObject>& ChildRef : Pair.Key->Children)
+			{
+				const FObject& Child = ChildRef.Get();
+				const FString Schema = Child.GetSchema();
+				if (Schema == "AbcGeom_FaceSet_v1")
+				{
+					continue;
+				}
+
+				if (Schema == "AbcGeom_PolyMesh_v1")
+				{
+					Meshes.Add({ &Child, Pair.Value });
+					Objects.Emplace(&Child, Pair.Value);
+				}
+				else if (Child.Properties && Child.FindScalarProperty(".xform/.ops") && Child.FindScalarProperty(".xform/.vals"))
+				{
+					Objects.Emplace(&Child, AddBone(Child, Pair.Value));
+				}
+				else
+				{
+					// groups without a transform do not need a bone
+					Objects.Emplace(&Child, Pair.Value);
+				}
+			}
+		}
+
+		// non inheriting bones are moved out of the world matrix of the root, that depends on the objects above it
+		if (Bones.ContainsByPredicate([](const FBone& Bone) { return !Bone.bInherits; }))
+		{
+			for (const FObject* Ancestor = Root.Parent.Get(); Ancestor; Ancestor = Ancestor->Parent.Get())
+			{
+				FXformTrack& AncestorTrack = AncestorsTracks.AddDefaulted_GetRef();
+				if (Ancestor->Properties)
+				{
+					BakeXformTrack(*Ancestor, AncestorTrack);
+				}
+				AncestorsInherits.Add(GetInherits(*Ancestor));
+			}
+		}
+
+		return Meshes.Num() > 0;
+	}
+
+	FMatrix FRigidSkeleton::GetAncestorsMatrix(const int32 SampleIndex) const
+	{
+		FMatrix Matrix = FMatrix::Identity;
+		for (int32 AncestorIndex = 0; AncestorIndex < AncestorsTracks.Num(); AncestorIndex++)
+		{
+			Matrix = Matrix * AncestorsTracks[AncestorIndex].GetTransform(SampleIndex).ToMatrixWithScale();
+			if (!AncestorsInherits[AncestorIndex])
+			{
+				break;
+			}
+		}
+		return Matrix;
+	}
+
+	bool FRigidSkeleton::AreAncestorsAnimated() const
+	{
+		for (int32 AncestorIndex = 0; AncestorIndex < AncestorsTracks.Num(); AncestorIndex++)
+		{
+			if (AncestorsTracks[AncestorIndex].IsAnimated())
+			{
+				return true;
+			}
+
+			if (!AncestorsInherits[AncestorIndex])
+			{
+				break;
+			}
+		}
+		return false;
+	}
+
+	FTransform FRigidSkeleton::GetBoneTransform(const TArray<FXformTrack>& Tracks, const int32 BoneIndex, const int32 SampleIndex) const
+	{
+		const FBone& Bone = Bones[BoneIndex];
+		const FTransform Transform = Tracks[BoneIndex].GetTransform(SampleIndex);
+		if (Bone.bInherits)
+		{
+			return Transform;
+		}
+
+		// the skeleton lives in the space of the parent of the root, a non inheriting root removes it
+		if (BoneIndex == 0)
+		{
+			return FTransform(Transform.ToMatrixWithScale() * GetAncestorsMatrix(SampleIndex).Inverse());
+		}
+
+		FMatrix RootMatrix = Tracks[0].GetTransform(SampleIndex).ToMatrixWithScale();
+		if (Bones[0].bInherits)
+		{
+			RootMatrix = RootMatrix * GetAncestorsMatrix(SampleIndex);
+		}
+
+		return FTransform(Transform.ToMatrixWithScale() * RootMatrix.Inverse());
+	}
+
+	bool FRigidSkeleton::IsBoneAnimated(const TArray<FXformTrack>& Tracks, const int32 BoneIndex) const
+	{
+		if (Tracks[BoneIndex].IsAnimated())
+		{
+			return true;
+		}
+
+		if (Bones[BoneIndex].bInherits)
+		{
+			return false;
+		}
+
+		if (BoneIndex == 0)
+		{
+			return AreAncestorsAnimated();
+		}
+
+		return Tracks[0].IsAnimated() || (Bones[0].bInherits && AreAncestorsAnimated());
+	}
+}
\ No newline at end of file
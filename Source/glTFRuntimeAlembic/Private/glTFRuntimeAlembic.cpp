@@ -1,9 +1,25 @@
 // Copyright 2025 - Roberto De Ioris
 
 #include "glTFRuntimeAlembic.h"
+#include "glTFRuntimeAlembicStats.h"
 
 #define LOCTEXT_NAMESPACE "FglTFRuntimeAlembicModule"
 
+DEFINE_STAT(STAT_glTFRuntimeAlembic_MikkTSpaceTangents);
+DEFINE_STAT(STAT_glTFRuntimeAlembic_MikkTSpaceTangentsCacheHits);
+DEFINE_STAT(STAT_glTFRuntimeAlembic_VertexCacheOptimization);
+DEFINE_STAT(STAT_glTFRuntimeAlembic_MeshSimplification);
+DEFINE_STAT(STAT_glTFRuntimeAlembic_GeometryCacheBake);
+DEFINE_STAT(STAT_glTFRuntimeAlembic_MissedPrefetches);
+DEFINE_STAT(STAT_glTFRuntimeAlembic_FrameStoreDecode);
+DEFINE_STAT(STAT_glTFRuntimeAlembic_InPlaceMeshUpdates);
+DEFINE_STAT(STAT_glTFRuntimeAlembic_SkeletalMeshBake);
+DEFINE_STAT(STAT_glTFRuntimeAlembic_StaticMeshMerge);
+DEFINE_STAT(STAT_glTFRuntimeAlembic_FlattenedXforms);
+DEFINE_STAT(STAT_glTFRuntimeAlembic_HiddenObjects);
+DEFINE_STAT(STAT_glTFRuntimeAlembic_CurvesRead);
+DEFINE_STAT(STAT_glTFRuntimeAlembic_HairDescriptionFill);
+
 void FglTFRuntimeAlembicModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
@@ -3,10 +3,22 @@
 
 #include "glTFRuntimeAlembicAssetActor.h"
 #include "glTFRuntimeABCFunctionLibrary.h"
+#include "glTFRuntimeABCMesh.h"
+#include "glTFRuntimeAlembicStats.h"
+#include "glTFRuntimeAlembicStreamingMeshComponent.h"
+#include "glTFRuntimeAlembicGroomCacheComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Animation/AnimSequence.h"
+#include "Components/SkeletalMeshComponent.h"
 #include "glTFRuntimeGeomCacheComponent.h"
-#include "glTFRuntimeGeomCacheFuncLibrary.h"
+#include "GeometryCacheComponent.h"
 #include "GroomComponent.h"
+#include "HairDescription.h"
+#include "glTFRuntimeGeomCacheFuncLibrary.h"
 #include "glTFRuntimeGeometryCacheTrack.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "UObject/StrongObjectPtr.h"
 
 // Sets default values
 AglTFRuntimeAlembicAssetActor::AglTFRuntimeAlembicAssetActor()
@@ -34,6 +46,12 @@ void AglTFRuntimeAlembicAssetActor::BeginPlay()
 		return;
 	}
 
+	if (bAsyncLoad)
+	{
+		LoadAsync();
+		return;
+	}
+
 	TSharedPtr<glTFRuntimeAlembic::FObject> RootObject = glTFRuntimeAlembic::ParseArchive(Asset->GetParser()->GetBlob());
 	if (!RootObject)
 	{
@@ -41,9 +59,22 @@ void AglTFRuntimeAlembicAssetActor::BeginPlay()
 		return;
 	}
 
+	glTFRuntimeAlembic::BakeVisibilityTracks(*RootObject, VisibilityTracks);
+
+	// the xform tracks exclude the animated subtrees from instancing
+	if (bPlayAnimation)
+	{
+		glTFRuntimeAlembic::BakeXformTracks(*RootObject, XformTracks);
+	}
+
+	if (bInstanceIdenticalMeshes && !bUseGeometryCache)
+	{
+		CollectMeshDigests(*RootObject, TSet<FString>(SkeletalMeshObjectPaths), TSet<FString>(MergedStaticMeshObjectPaths), VisibilityTracks, XformTracks, bPlayAnimation, SampleIndex, MeshDigests, MeshDigestsCounters);
+	}
+
 	ProcessObject(AssetRoot, RootObject.ToSharedRef());
 
-	ReceiveOnScenesLoaded();
+	FinishLoading();
 }
 
 // Called every frame
@@ -51,6 +82,407 @@ void AglTFRuntimeAlembicAssetActor::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	if (bAsyncLoading)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		// at least one object per frame, processing an object can enqueue its children
+		do
+		{
+			if (AsyncPendingObjectIndex >= AsyncPendingObjects.Num())
+			{
+				FinishLoading();
+				break;
+			}
+
+			USceneComponent* Component = AsyncPendingObjects[AsyncPendingObjectIndex].Key;
+			TSharedRef<glTFRuntimeAlembic::FObject> Object = AsyncPendingObjects[AsyncPendingObjectIndex].Value;
+			AsyncPendingObjectIndex++;
+
+			ProcessObject(Component, Object);
+		} while (FPlatformTime::Seconds() - StartTime < AsyncTimeSlice);
+	}
+	else if (NumAnimationSamples > 0)
+	{
+		if (bAnimationPlaying)
+		{
+			PlaybackTime += DeltaTime * PlayRate;
+		}
+		// even when paused, a missed sample is shown as soon as it is decoded
+		UpdateAnimation();
+	}
+	else if (AnimatedVisibilities.Num() > 0)
+	{
+		UpdateGeometryCacheVisibilities();
+	}
+}
+
+void AglTFRuntimeAlembicAssetActor::UpdateGeometryCacheVisibilities()
+{
+	int32 NewSampleIndex = INDEX_NONE;
+	if (UglTFRuntimeAlembicStreamingMeshComponent* StreamingMeshComponent = Cast<UglTFRuntimeAlembicStreamingMeshComponent>(GeometryCacheClock))
+	{
+		NewSampleIndex = StreamingMeshComponent->GetDisplayedSampleIndex();
+	}
+	else if (UglTFRuntimeAlembicGroomCacheComponent* GroomCacheComponent = Cast<UglTFRuntimeAlembicGroomCacheComponent>(GeometryCacheClock))
+	{
+		NewSampleIndex = GroomCacheComponent->GetDisplayedSampleIndex();
+	}
+	else if (UGeometryCacheComponent* GeometryCacheComponent = Cast<UGeometryCacheComponent>(GeometryCacheClock))
+	{
+		// baked caches start at the first sample and keep the original timing (24 samples per second)
+		float Time = GeometryCacheComponent->GetAnimationTime();
+		const int32 NumCacheSamples = FMath::RoundToInt(GeometryCacheComponent->GetDuration() * 24) + 1;
+		NewSampleIndex = FMath::Max(AlembicConfig.FirstSampleIndex, 0) + glTFRuntimeAlembic::GetPlaybackSampleIndex(Time, NumCacheSamples, 24, GeometryCacheComponent->IsLooping());
+	}
+
+	if (NewSampleIndex == INDEX_NONE || NewSampleIndex == AnimationSampleIndex)
+	{
+		return;
+	}
+
+	for (const FAnimatedVisibility& AnimatedVisibility : AnimatedVisibilities)
+	{
+		if (IsValid(AnimatedVisibility.Component))
+		{
+			AnimatedVisibility.Component->SetVisibility(AnimatedVisibility.Track.IsVisible(NewSampleIndex));
+		}
+	}
+	AnimationSampleIndex = NewSampleIndex;
+}
+
+void AglTFRuntimeAlembicAssetActor::Play()
+{
+	bAnimationPlaying = true;
+}
+
+void AglTFRuntimeAlembicAssetActor::Pause()
+{
+	bAnimationPlaying = false;
+}
+
+void AglTFRuntimeAlembicAssetActor::Seek(const float Time)
+{
+	PlaybackTime = Time;
+	UpdateAnimation();
+}
+
+void AglTFRuntimeAlembicAssetActor::UpdateAnimation()
+{
+	if (NumAnimationSamples <= 0)
+	{
+		return;
+	}
+
+	const int32 NewSampleIndex = glTFRuntimeAlembic::GetPlaybackSampleIndex(PlaybackTime, NumAnimationSamples, FramesPerSecond, bLooping);
+	const float NewSampleAlpha = bInterpolateSamples ? FMath::Clamp(PlaybackTime * FramesPerSecond - NewSampleIndex, 0.0f, 1.0f) : 0;
+	if (NewSampleIndex != AnimationSampleIndex || NewSampleAlpha != AnimationSampleAlpha)
+	{
+		for (const FAnimatedXform& AnimatedXform : AnimatedXforms)
+		{
+			if (IsValid(AnimatedXform.Component))
+			{
+				AnimatedXform.Component->SetRelativeTransform(Asset->GetParser()->TransformTransform(AnimatedXform.Track.GetTransform(NewSampleIndex, NewSampleAlpha)) * AnimatedXform.Offset);
+			}
+		}
+
+		for (const FAnimatedVisibility& AnimatedVisibility : AnimatedVisibilities)
+		{
+			if (IsValid(AnimatedVisibility.Component))
+			{
+				AnimatedVisibility.Component->SetVisibility(AnimatedVisibility.Track.IsVisible(NewSampleIndex));
+			}
+		}
+
+		for (const FAnimatedSkeletalMesh& AnimatedSkeletalMesh : AnimatedSkeletalMeshes)
+		{
+			if (IsValid(AnimatedSkeletalMesh.Component))
+			{
+				const float Position = (NewSampleIndex + NewSampleAlpha - AnimatedSkeletalMesh.FirstSampleIndex) / FramesPerSecond;
+				AnimatedSkeletalMesh.Component->SetPosition(FMath::Clamp(Position, 0.0f, AnimatedSkeletalMesh.Duration), false);
+			}
+		}
+		AnimationSampleIndex = NewSampleIndex;
+		AnimationSampleAlpha = NewSampleAlpha;
+	}
+
+	// decoding happens in the components ring buffers, a sample not ready yet is a missed prefetch (the previous one stays visible)
+	for (const FAnimatedMesh& AnimatedMesh : AnimatedMeshes)
+	{
+		UglTFRuntimeAlembicStreamingMeshComponent* StreamingMeshComponent = AnimatedMesh.Component;
+		if (!IsValid(StreamingMeshComponent))
+		{
+			continue;
+		}
+
+		if (AnimatedMesh.Visibility.IsAnimated())
+		{
+			StreamingMeshComponent->SetVisibility(AnimatedMesh.Visibility.IsVisible(NewSampleIndex));
+			// decoding and prefetching are suspended while hidden, they resume as soon as the mesh is going to be shown within the prefetch window
+			const int32 PrefetchSampleIndex = NewSampleIndex + (bAnimationPlaying && PlayRate < 0 ? -1 : 1) * StreamingMeshComponent->PrefetchWindow;
+			if (!AnimatedMesh.Visibility.IsVisibleInRange(NewSampleIndex, PrefetchSampleIndex))
+			{
+				continue;
+			}
+		}
+
+		StreamingMeshComponent->SetSampleIndex(NewSampleIndex, bAnimationPlaying ? PlayRate : 1, bLooping, NewSampleAlpha);
+	}
+
+	// groom caches are built on worker threads, the first sample stays visible until they are ready
+	for (UglTFRuntimeAlembicGroomCacheComponent* GroomCacheComponent : AnimatedGrooms)
+	{
+		if (IsValid(GroomCacheComponent))
+		{
+			GroomCacheComponent->SetSampleIndex(NewSampleIndex);
+		}
+	}
+}
+
+void AglTFRuntimeAlembicAssetActor::LoadAsync()
+{
+	TWeakObjectPtr<AglTFRuntimeAlembicAssetActor> WeakThis(this);
+	// keeps the asset alive while the task runs, released on the game thread
+	TSharedPtr<TStrongObjectPtr<UglTFRuntimeAsset>> StrongAsset = MakeShared<TStrongObjectPtr<UglTFRuntimeAsset>>(Asset);
+
+	Async(EAsyncExecution::ThreadPool, [WeakThis, StrongAsset, AsyncSampleIndex = SampleIndex, MaterialsConfig = StaticMeshConfig.MaterialsConfig, AsyncAlembicConfig = AlembicConfig, bBuildMeshes = !bUseGeometryCache, bBakeGeometryCaches = bUseGeometryCache && !bStreamGeometryCache, bInstance = bInstanceIdenticalMeshes && !bUseGeometryCache, bSkipAnimated = bPlayAnimation, bAllSamples = bPlayAnimation || bUseGeometryCache, SkeletalMeshPaths = TSet<FString>(SkeletalMeshObjectPaths), MergedPaths = TSet<FString>(MergedStaticMeshObjectPaths), ChunkSize = MergedStaticMeshChunkSize, CurvesKeyframeInterval = GetDefault<UglTFRuntimeAlembicGroomCacheComponent>()->CompressedKeyframeInterval, bStreamAll = bUseGeometryCache && bStreamGeometryCache, bStreamAnimated = bPlayAnimation && !bUseGeometryCache, bCompressStreams = bCompressStreamedSamples, FramesKeyframeInterval = GetDefault<UglTFRuntimeAlembicStreamingMeshComponent>()->CompressedKeyframeInterval, SkeletalMaterialsConfig = SkeletalMeshConfig.MaterialsConfig, bBakeAnimations = bPlayAnimation, AsyncFramesPerSecond = FramesPerSecond]() mutable
+		{
+			UglTFRuntimeAsset* AsyncAsset = StrongAsset->Get();
+
+			FAsyncLoadResult Result;
+			Result.RootObject = glTFRuntimeAlembic::ParseArchive(AsyncAsset->GetParser()->GetBlob());
+			TSharedPtr<glTFRuntimeAlembic::FObject> RootObject = Result.RootObject;
+
+			if (RootObject)
+			{
+				glTFRuntimeAlembic::BakeVisibilityTracks(*RootObject, Result.VisibilityTracks);
+			}
+
+			// every sample of the animated xforms, played back by the game thread (and excluded from instancing)
+			if (RootObject && bSkipAnimated)
+			{
+				glTFRuntimeAlembic::BakeXformTracks(*RootObject, Result.XformTracks);
+			}
+
+			if (RootObject && bInstance)
+			{
+				CollectMeshDigests(*RootObject, SkeletalMeshPaths, MergedPaths, Result.VisibilityTracks, Result.XformTracks, bSkipAnimated, AsyncSampleIndex, Result.MeshDigests, Result.MeshDigestsCounters);
+			}
+
+			// static meshes (once per digest when instancing), skeletal meshes, baked geometry caches, compressed streams and grooms are decoded here, everything else is left to the game thread
+			TArray<TSharedRef<glTFRuntimeAlembic::FObject>> PolyMeshes;
+			TArray<TSharedRef<glTFRuntimeAlembic::FObject>> GeometryCaches;
+			TArray<TSharedRef<glTFRuntimeAlembic::FObject>> StreamedPolyMeshes;
+			TArray<TSharedRef<glTFRuntimeAlembic::FObject>> SkeletalMeshes;
+			TArray<TSharedRef<glTFRuntimeAlembic::FObject>> Grooms;
+			if (RootObject)
+			{
+				TArray<TSharedRef<glTFRuntimeAlembic::FObject>> Objects = { RootObject.ToSharedRef() };
+				while (Objects.Num() > 0)
+				{
+					TSharedRef<glTFRuntimeAlembic::FObject> Object = Objects.Pop(EAllowShrinking::No);
+					// never shown
+					if (IsHiddenObject(Result.VisibilityTracks, *Object, bAllSamples, AsyncSampleIndex))
+					{
+						continue;
+					}
+
+					// the whole subtree becomes a single skeletal mesh
+					if (SkeletalMeshPaths.Contains(Object->Path))
+					{
+						SkeletalMeshes.Add(Object);
+						continue;
+					}
+
+					// merged (in parallel) here, the game thread only creates the components
+					if (bBuildMeshes && MergedPaths.Contains(Object->Path) && Object->GetSchema() != "AbcGeom_PolyMesh_v1")
+					{
+						TArray<FglTFRuntimeMeshLOD> ChunksLODs;
+						if (UglTFRuntimeABCFunctionLibrary::LoadMergedRuntimeLODsFromAlembicObject(AsyncAsset, *Object, AsyncSampleIndex, ChunksLODs, MaterialsConfig, AsyncAlembicConfig, ChunkSize))
+						{
+							Result.MergedMeshesLODs.Add(&Object.Get(), MoveTemp(ChunksLODs));
+						}
+						continue;
+					}
+					Objects.Append(Object->Children);
+
+					const FString Schema = Object->GetSchema();
+					if (Schema == "AbcGeom_Curve_v2")
+					{
+						Grooms.Add(Object);
+						continue;
+					}
+
+					if (Schema != "AbcGeom_PolyMesh_v1")
+					{
+						continue;
+					}
+
+					// streamed by the game thread, from the archive or from a frame store compressed here
+					if (bStreamAll || (bStreamAnimated && IsAnimatedPolyMesh(*Object)))
+					{
+						if (bCompressStreams)
+						{
+							StreamedPolyMeshes.Add(Object);
+						}
+						continue;
+					}
+
+					if (bBakeGeometryCaches)
+					{
+						GeometryCaches.Add(Object);
+						continue;
+					}
+
+					if (!bBuildMeshes)
+					{
+						continue;
+					}
+
+					if (const glTFRuntimeAlembic::FSampleDigest* Digest = Result.MeshDigests.Find(&Object.Get()))
+					{
+						if (Result.MeshesRepresentatives.Contains(*Digest))
+						{
+							continue;
+						}
+						Result.MeshesRepresentatives.Add(*Digest, &Object.Get());
+					}
+
+					PolyMeshes.Add(Object);
+				}
+			}
+
+			TArray<TArray<FglTFRuntimeMeshLOD>> PolyMeshesLODs;
+			PolyMeshesLODs.SetNum(PolyMeshes.Num());
+			ParallelFor(PolyMeshes.Num(), [&](const int32 PolyMeshIndex)
+				{
+					LoadMeshLODs(AsyncAsset, *PolyMeshes[PolyMeshIndex], AsyncSampleIndex, MaterialsConfig, AsyncAlembicConfig, PolyMeshesLODs[PolyMeshIndex]);
+				});
+
+			for (int32 PolyMeshIndex = 0; PolyMeshIndex < PolyMeshes.Num(); PolyMeshIndex++)
+			{
+				if (PolyMeshesLODs[PolyMeshIndex].Num() > 0)
+				{
+					Result.MeshesLODs.Add(&PolyMeshes[PolyMeshIndex].Get(), MoveTemp(PolyMeshesLODs[PolyMeshIndex]));
+				}
+			}
+
+			// frames, strands and compressed curves are already decoded in parallel, one object at a time
+			for (const TSharedRef<glTFRuntimeAlembic::FObject>& Object : GeometryCaches)
+			{
+				TSharedPtr<TArray<FglTFRuntimeGeometryCacheFrame>> Frames = MakeShared<TArray<FglTFRuntimeGeometryCacheFrame>>();
+				if (UglTFRuntimeABCFunctionLibrary::LoadGeometryCacheFramesFromAlembicObject(AsyncAsset, *Object, *Frames, MaterialsConfig, AsyncAlembicConfig))
+				{
+					Result.GeometryCachesFrames.Add(&Object.Get(), Frames);
+				}
+			}
+
+			for (const TSharedRef<glTFRuntimeAlembic::FObject>& Object : SkeletalMeshes)
+			{
+				TSharedPtr<glTFRuntimeAlembic::FRigidSkeletalMesh> RigidSkeletalMesh = MakeShared<glTFRuntimeAlembic::FRigidSkeletalMesh>();
+				if (UglTFRuntimeABCFunctionLibrary::LoadRigidSkeletalMeshFromAlembicObject(AsyncAsset, *Object, SkeletalMaterialsConfig, AsyncAlembicConfig, *RigidSkeletalMesh, bBakeAnimations, AsyncFramesPerSecond))
+				{
+					Result.RigidSkeletalMeshes.Add(&Object.Get(), RigidSkeletalMesh);
+				}
+			}
+
+			for (const TSharedRef<glTFRuntimeAlembic::FObject>& Object : StreamedPolyMeshes)
+			{
+				if (TSharedPtr<glTFRuntimeAlembic::FCompressedFrameStore> FrameStore = UglTFRuntimeABCFunctionLibrary::LoadCompressedFrameStoreFromAlembicObject(AsyncAsset, *Object, MaterialsConfig, AsyncAlembicConfig, FramesKeyframeInterval))
+				{
+					Result.FrameStores.Add(&Object.Get(), FrameStore);
+				}
+			}
+
+			for (const TSharedRef<glTFRuntimeAlembic::FObject>& Object : Grooms)
+			{
+				TSharedPtr<FHairDescription> HairDescription = MakeShared<FHairDescription>();
+				if (UglTFRuntimeABCFunctionLibrary::LoadHairDescriptionFromAlembicObject(AsyncAsset, *Object, *HairDescription))
+				{
+					Result.HairDescriptions.Add(&Object.Get(), HairDescription);
+				}
+
+				// played by a groom cache component
+				if (bAllSamples && IsAnimatedCurves(*Object))
+				{
+					if (TSharedPtr<glTFRuntimeAlembic::FCompressedCurvesStore> CurvesStore = UglTFRuntimeABCFunctionLibrary::LoadCompressedCurvesStoreFromAlembicObject(*Object, CurvesKeyframeInterval))
+					{
+						Result.CurvesStores.Add(&Object.Get(), CurvesStore);
+					}
+				}
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, StrongAsset = MoveTemp(StrongAsset), Result = MoveTemp(Result)]() mutable
+				{
+					if (AglTFRuntimeAlembicAssetActor* Actor = WeakThis.Get())
+					{
+						Actor->OnAsyncMeshesLoaded(MoveTemp(Result));
+					}
+				});
+		});
+}
+
+void AglTFRuntimeAlembicAssetActor::OnAsyncMeshesLoaded(FAsyncLoadResult&& Result)
+{
+	if (!Asset)
+	{
+		return;
+	}
+
+	if (!Result.RootObject)
+	{
+		Asset->GetParser()->AddError("AglTFRuntimeAlembicAssetActor::OnAsyncMeshesLoaded()", "Invalid Alembic archive");
+		return;
+	}
+
+	AsyncRootObject = Result.RootObject;
+	AsyncMeshesLODs = MoveTemp(Result.MeshesLODs);
+	AsyncMeshesRepresentatives = MoveTemp(Result.MeshesRepresentatives);
+	AsyncMergedMeshesLODs = MoveTemp(Result.MergedMeshesLODs);
+	AsyncGeometryCachesFrames = MoveTemp(Result.GeometryCachesFrames);
+	AsyncHairDescriptions = MoveTemp(Result.HairDescriptions);
+	AsyncCurvesStores = MoveTemp(Result.CurvesStores);
+	AsyncFrameStores = MoveTemp(Result.FrameStores);
+	AsyncRigidSkeletalMeshes = MoveTemp(Result.RigidSkeletalMeshes);
+	MeshDigests = MoveTemp(Result.MeshDigests);
+	MeshDigestsCounters = MoveTemp(Result.MeshDigestsCounters);
+	XformTracks = MoveTemp(Result.XformTracks);
+	VisibilityTracks = MoveTemp(Result.VisibilityTracks);
+
+	AsyncPendingObjects.Emplace(AssetRoot, Result.RootObject.ToSharedRef());
+	AsyncPendingObjectIndex = 0;
+	bAsyncLoading = true;
+}
+
+void AglTFRuntimeAlembicAssetActor::FinishLoading()
+{
+	MeshDigests.Empty();
+	MeshDigestsCounters.Empty();
+	InstancedMeshComponents.Empty();
+
+	bAsyncLoading = false;
+	AsyncPendingObjects.Empty();
+	AsyncPendingObjectIndex = 0;
+	AsyncMeshesLODs.Empty();
+	AsyncMeshesRepresentatives.Empty();
+	AsyncMergedMeshesLODs.Empty();
+	AsyncGeometryCachesFrames.Empty();
+	AsyncHairDescriptions.Empty();
+	AsyncCurvesStores.Empty();
+	AsyncFrameStores.Empty();
+	AsyncRigidSkeletalMeshes.Empty();
+	AsyncRootObject.Reset();
+	FlattenedOffsets.Empty();
+	XformTracks.Empty();
+	VisibilityTracks.Empty();
+
+	if (bPlayAnimation)
+	{
+		bAnimationPlaying = true;
+		AnimationSampleIndex = INDEX_NONE;
+		UpdateAnimation();
+	}
+
+	ReceiveOnScenesLoaded();
 }
 
 void AglTFRuntimeAlembicAssetActor::ProcessObject(USceneComponent* Component, TSharedRef<glTFRuntimeAlembic::FObject> Object)
@@ -63,49 +495,175 @@ void AglTFRuntimeAlembicAssetActor::ProcessObject(USceneComponent* Component, TS
 		Component->ComponentTags.Add(FName(FString::Printf(TEXT("glTFRuntimeAlembic::Object::Metadata::%s=%s"), *Pair.Key, *Pair.Value)));
 	}
 
+	// hidden at some sample (by the object or one of its ancestors), streaming meshes toggle their visibility along with their decoding
+	const glTFRuntimeAlembic::FVisibilityTrack* VisibilityTrack = VisibilityTracks.Find(&Object.Get());
+	if (VisibilityTrack)
+	{
+		Component->SetVisibility(VisibilityTrack->IsVisible(SampleIndex));
+		// without playback, geometry caches play on their own and the visibility follows their time
+		if (VisibilityTrack->IsAnimated() && (bPlayAnimation ? !Component->IsA<UglTFRuntimeAlembicStreamingMeshComponent>() : bUseGeometryCache))
+		{
+			if (bPlayAnimation)
+			{
+				NumAnimationSamples = FMath::Max(NumAnimationSamples, VisibilityTrack->NumSamples());
+			}
+			FAnimatedVisibility& AnimatedVisibility = AnimatedVisibilities.AddDefaulted_GetRef();
+			AnimatedVisibility.Component = Component;
+			AnimatedVisibility.Track = *VisibilityTrack;
+		}
+	}
+
 	if (UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component))
 	{
-		FglTFRuntimeMeshLOD LOD;
-		if (UglTFRuntimeABCFunctionLibrary::LoadAlembicObjectAsRuntimeLOD(Asset, Object->Path, SampleIndex, LOD, StaticMeshConfig.MaterialsConfig))
+		if (UStaticMesh* StaticMesh = LoadStaticMesh(Object))
 		{
-			UStaticMesh* StaticMesh = Asset->LoadStaticMeshFromRuntimeLODs({ LOD }, StaticMeshConfig);
-			if (StaticMesh)
+			StaticMeshComponent->SetStaticMesh(StaticMesh);
+		}
+	}
+	else if (UglTFRuntimeAlembicStreamingMeshComponent* StreamingMeshComponent = Cast<UglTFRuntimeAlembicStreamingMeshComponent>(Component))
+	{
+		// in playback mode the actor drives all the components from its own time
+		StreamingMeshComponent->bPlaying = !bPlayAnimation;
+		StreamingMeshComponent->bLooping = bLooping;
+		StreamingMeshComponent->FramesPerSecond = FramesPerSecond;
+		StreamingMeshComponent->PlaybackTime = PlaybackTime;
+		StreamingMeshComponent->bInterpolateSamples = bInterpolateSamples;
+		StreamingMeshComponent->bCompressFrames = bCompressStreamedSamples;
+
+		// already compressed by the async task
+		TSharedPtr<const glTFRuntimeAlembic::FCompressedFrameStore> FrameStore = AsyncFrameStores.FindRef(&Object.Get());
+		AsyncFrameStores.Remove(&Object.Get());
+
+		const bool bOpened = FrameStore ? StreamingMeshComponent->OpenFrameStore(Asset, Object, StaticMeshConfig.MaterialsConfig, AlembicConfig, FrameStore.ToSharedRef()) : StreamingMeshComponent->OpenAlembicObject(Asset, Object, StaticMeshConfig.MaterialsConfig, AlembicConfig);
+		if (!bOpened)
+		{
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to stream %s"), *Object->Path);
+		}
+		else if (!bPlayAnimation && !GeometryCacheClock)
+		{
+			GeometryCacheClock = StreamingMeshComponent;
+		}
+		else if (bPlayAnimation)
+		{
+			FAnimatedMesh& AnimatedMesh = AnimatedMeshes.AddDefaulted_GetRef();
+			AnimatedMesh.Component = StreamingMeshComponent;
+			if (VisibilityTrack)
 			{
-				StaticMeshComponent->SetStaticMesh(StaticMesh);
+				AnimatedMesh.Visibility = *VisibilityTrack;
+				NumAnimationSamples = FMath::Max(NumAnimationSamples, VisibilityTrack->NumSamples());
 			}
+			NumAnimationSamples = FMath::Max(NumAnimationSamples, StreamingMeshComponent->GetNumSamples());
 		}
 	}
 	else if (UglTFRuntimeGeomCacheComponent* GeomCacheComponent = Cast<UglTFRuntimeGeomCacheComponent>(Component))
 	{
-		// retrieve the number of frames from .geom/P
-		TSharedPtr<glTFRuntimeAlembic::FArrayProperty> PositionsProperty = Object->FindArrayProperty(".geom/P");
-		if (PositionsProperty)
+		// already baked by the async task
+		UGeometryCache* GeometryCache = nullptr;
+		if (TSharedPtr<TArray<FglTFRuntimeGeometryCacheFrame>> AsyncFrames = AsyncGeometryCachesFrames.FindRef(&Object.Get()))
+		{
+			GeometryCache = UglTFRuntimeABCFunctionLibrary::LoadGeometryCacheFromFrames(*AsyncFrames);
+			AsyncGeometryCachesFrames.Remove(&Object.Get());
+		}
+		else
+		{
+			GeometryCache = UglTFRuntimeABCFunctionLibrary::LoadGeometryCacheFromAlembicObject(Asset, *Object, StaticMeshConfig.MaterialsConfig, AlembicConfig);
+		}
+
+		if (!GeometryCache)
+		{
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to load geometry cache from %s"), *Object->Path);
+		}
+		else
 		{
-			const uint32 NumFrames = PositionsProperty->NextSampleIndex;
-			TArray<FglTFRuntimeGeometryCacheFrame> Frames;
-			Frames.AddDefaulted(NumFrames);
-			for (uint32 FrameIndex = 0; FrameIndex < NumFrames; FrameIndex++)
+			GeomCacheComponent->SetGeometryCache(GeometryCache);
+			if (!GeometryCacheClock)
 			{
-				Frames[FrameIndex].Time = (1.0 / 24) * FrameIndex;
-				if (!UglTFRuntimeABCFunctionLibrary::LoadAlembicObjectAsRuntimeLOD(Asset, Object->Path, FrameIndex, Frames[FrameIndex].Mesh, StaticMeshConfig.MaterialsConfig))
-				{
-					UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to load sample %u from %s"), FrameIndex, *Object->Path);
-				}
+				GeometryCacheClock = GeomCacheComponent;
 			}
-			UglTFRuntimeGeometryCacheTrack* Track = UglTFRuntimeGeomCacheFuncLibrary::LoadRuntimeTrackFromGeometryCacheFrames(Frames);
-			if (Track)
+		}
+	}
+	else if (USkeletalMeshComponent* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(Component))
+	{
+		// already baked by the async task
+		UAnimSequence* AnimSequence = nullptr;
+		USkeletalMesh* SkeletalMesh = nullptr;
+		if (TSharedPtr<glTFRuntimeAlembic::FRigidSkeletalMesh> RigidSkeletalMesh = AsyncRigidSkeletalMeshes.FindRef(&Object.Get()))
+		{
+			SkeletalMesh = UglTFRuntimeABCFunctionLibrary::LoadSkeletalMeshFromRigidSkeletalMesh(Asset, *RigidSkeletalMesh, SkeletalMeshConfig, bPlayAnimation ? &AnimSequence : nullptr);
+			AsyncRigidSkeletalMeshes.Remove(&Object.Get());
+		}
+		else
+		{
+			SkeletalMesh = UglTFRuntimeABCFunctionLibrary::LoadSkeletalMeshFromAlembicObject(Asset, *Object, SkeletalMeshConfig, AlembicConfig, bPlayAnimation ? &AnimSequence : nullptr, FramesPerSecond);
+		}
+		if (!SkeletalMesh)
+		{
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to load skeletal mesh from %s"), *Object->Path);
+		}
+		else
+		{
+			SkeletalMeshComponent->SetSkeletalMesh(SkeletalMesh);
+			if (AnimSequence)
 			{
-				UGeometryCache* GeometryCache = UglTFRuntimeGeomCacheFuncLibrary::LoadGeometryCacheFromRuntimeTracks({ Track });
-				if (GeometryCache)
-				{
-					GeomCacheComponent->SetGeometryCache(GeometryCache);
-				}
+				// the animation does not advance on its own, UpdateAnimation sets its position
+				SkeletalMeshComponent->SetAnimationMode(EAnimationMode::AnimationSingleNode);
+				SkeletalMeshComponent->SetAnimation(AnimSequence);
+				SkeletalMeshComponent->Stop();
+
+				FAnimatedSkeletalMesh& AnimatedSkeletalMesh = AnimatedSkeletalMeshes.AddDefaulted_GetRef();
+				AnimatedSkeletalMesh.Component = SkeletalMeshComponent;
+				AnimatedSkeletalMesh.FirstSampleIndex = FMath::Max(AlembicConfig.FirstSampleIndex, 0);
+				AnimatedSkeletalMesh.Duration = AnimSequence->GetPlayLength();
+				NumAnimationSamples = FMath::Max(NumAnimationSamples, AnimatedSkeletalMesh.FirstSampleIndex + FMath::RoundToInt(AnimatedSkeletalMesh.Duration * FramesPerSecond) + 1);
 			}
 		}
+		// the whole subtree (including the object xform, as the root bone) lives in the skeletal mesh
+		return;
+	}
+	else if (UglTFRuntimeAlembicGroomCacheComponent* GroomCacheComponent = Cast<UglTFRuntimeAlembicGroomCacheComponent>(Component))
+	{
+		// in playback mode the actor drives all the components from its own time
+		GroomCacheComponent->bPlaying = !bPlayAnimation;
+		GroomCacheComponent->bLooping = bLooping;
+		GroomCacheComponent->FramesPerSecond = FramesPerSecond;
+		GroomCacheComponent->PlaybackTime = PlaybackTime;
+
+		// already compressed by the async task
+		TSharedPtr<FHairDescription> HairDescription = AsyncHairDescriptions.FindRef(&Object.Get());
+		TSharedPtr<const glTFRuntimeAlembic::FCompressedCurvesStore> CurvesStore = AsyncCurvesStores.FindRef(&Object.Get());
+		AsyncHairDescriptions.Remove(&Object.Get());
+		AsyncCurvesStores.Remove(&Object.Get());
+
+		const bool bOpened = HairDescription && CurvesStore ? GroomCacheComponent->OpenCurvesStore(Asset, CurvesStore.ToSharedRef(), HairDescription.ToSharedRef()) : GroomCacheComponent->OpenAlembicObject(Asset, Object);
+		if (!bOpened)
+		{
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to load groom cache from %s"), *Object->Path);
+		}
+		else if (!bPlayAnimation && !GeometryCacheClock)
+		{
+			GeometryCacheClock = GroomCacheComponent;
+		}
+		else if (bPlayAnimation)
+		{
+			AnimatedGrooms.Add(GroomCacheComponent);
+			NumAnimationSamples = FMath::Max(NumAnimationSamples, GroomCacheComponent->GetNumSamples());
+		}
 	}
 	else if (UGroomComponent* GroomComponent = Cast<UGroomComponent>(Component))
 	{
-		UGroomAsset* GroomAsset = UglTFRuntimeABCFunctionLibrary::LoadGroomFromAlembicObject(Asset, Object->Path);
+		// already decoded by the async task
+		TSharedPtr<FHairDescription> HairDescription = AsyncHairDescriptions.FindRef(&Object.Get());
+		AsyncHairDescriptions.Remove(&Object.Get());
+		if (!HairDescription)
+		{
+			HairDescription = MakeShared<FHairDescription>();
+			if (!UglTFRuntimeABCFunctionLibrary::LoadHairDescriptionFromAlembicObject(Asset, *Object, *HairDescription))
+			{
+				HairDescription.Reset();
+			}
+		}
+
+		UGroomAsset* GroomAsset = HairDescription ? UglTFRuntimeABCFunctionLibrary::LoadGroomFromHairDescription(MoveTemp(*HairDescription)) : nullptr;
 		if (!GroomAsset)
 		{
 			UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to load groom from %s"), *Object->Path);
@@ -117,40 +675,80 @@ void AglTFRuntimeAlembicAssetActor::ProcessObject(USceneComponent* Component, TS
 	}
 	else
 	{
-		if (TSharedPtr<glTFRuntimeAlembic::FScalarProperty> MatrixOpsProperty = Object->FindScalarProperty(".xform/.ops"))
+		const FTransform Offset = FlattenedOffsets.FindRef(Component);
+		if (!UpdateXform(Component, *Object, SampleIndex, Offset))
 		{
-			if (TSharedPtr<glTFRuntimeAlembic::FScalarProperty> MatrixValsProperty = Object->FindScalarProperty(".xform/.vals"))
-			{
-				uint32 MatrixOpsPropertyTrueSampleIndex;
-				if (!MatrixOpsProperty->GetSampleTrueIndex(SampleIndex, MatrixOpsPropertyTrueSampleIndex))
-				{
-					return;
-				}
-				uint32 MatrixValsPropertyTrueSampleIndex;
-				if (!MatrixValsProperty->GetSampleTrueIndex(SampleIndex, MatrixValsPropertyTrueSampleIndex))
-				{
-					return;
-				}
+			return;
+		}
 
-				FMatrix Matrix;
-				if (glTFRuntimeAlembic::BuildMatrix(MatrixOpsPropertyTrueSampleIndex, MatrixOpsProperty.ToSharedRef(), MatrixValsPropertyTrueSampleIndex, MatrixValsProperty.ToSharedRef(), Matrix))
-				{
-					Component->SetRelativeTransform(Asset->GetParser()->TransformTransform(FTransform(Matrix)));
-				}
+		if (bPlayAnimation)
+		{
+			glTFRuntimeAlembic::FXformTrack* Track = XformTracks.Find(&Object.Get());
+			if (Track && Track->IsAnimated())
+			{
+				NumAnimationSamples = FMath::Max(NumAnimationSamples, Track->NumSamples);
+				FAnimatedXform& AnimatedXform = AnimatedXforms.AddDefaulted_GetRef();
+				AnimatedXform.Component = Component;
+				AnimatedXform.Track = MoveTemp(*Track);
+				AnimatedXform.Offset = Offset;
 			}
 		}
+
+		// the children are replaced by the merged meshes
+		if (MergedStaticMeshObjectPaths.Contains(Object->Path) && !bUseGeometryCache)
+		{
+			AddMergedStaticMeshes(Component, *Object);
+			return;
+		}
 	}
 
+	AddChildComponents(Component, Object, FTransform::Identity);
+}
+
+void AglTFRuntimeAlembicAssetActor::AddChildComponents(USceneComponent* Component, const TSharedRef<glTFRuntimeAlembic::FObject>& Object, const FTransform& Offset)
+{
 	for (const TSharedRef<glTFRuntimeAlembic::FObject>& Child : Object->Children)
 	{
+		// face sets are consumed by their polymesh as material sections
+		if (Child->GetSchema() == "AbcGeom_FaceSet_v1")
+		{
+			continue;
+		}
+
+		if (IsHiddenObject(VisibilityTracks, *Child, bPlayAnimation || bUseGeometryCache, SampleIndex))
+		{
+			INC_DWORD_STAT(STAT_glTFRuntimeAlembic_HiddenObjects);
+			continue;
+		}
+
+		FTransform FlattenedTransform;
+		if (bFlattenStaticXforms && CanFlattenXform(*Child, FlattenedTransform))
+		{
+			INC_DWORD_STAT(STAT_glTFRuntimeAlembic_FlattenedXforms);
+			AddChildComponents(Component, Child, FlattenedTransform * Offset);
+			continue;
+		}
+
 		USceneComponent* ChildComponent = nullptr;
 
-		if (Child->GetSchema() == "AbcGeom_PolyMesh_v1")
+		if (SkeletalMeshObjectPaths.Contains(Child->Path))
 		{
-			if (bUseGeometryCache)
+			ChildComponent = NewObject<USkeletalMeshComponent>(this, MakeUniqueObjectName(this, USkeletalMeshComponent::StaticClass(), *Child->Name));
+		}
+		else if (Child->GetSchema() == "AbcGeom_PolyMesh_v1")
+		{
+			if ((bUseGeometryCache && bStreamGeometryCache) || (bPlayAnimation && !bUseGeometryCache && IsAnimatedPolyMesh(*Child)))
+			{
+				ChildComponent = NewObject<UglTFRuntimeAlembicStreamingMeshComponent>(this, MakeUniqueObjectName(this, UglTFRuntimeAlembicStreamingMeshComponent::StaticClass(), *Child->Name));
+			}
+			else if (bUseGeometryCache)
 			{
 				ChildComponent = NewObject<UglTFRuntimeGeomCacheComponent>(this, MakeUniqueObjectName(this, UglTFRuntimeGeomCacheComponent::StaticClass(), *Child->Name));
 			}
+			else if (!VisibilityTracks.Contains(&Child.Get()) && AddMeshInstance(Component, Child, Offset))
+			{
+				continue;
+			}
 			else
 			{
 				ChildComponent = NewObject<UStaticMeshComponent>(this, MakeUniqueObjectName(this, UStaticMeshComponent::StaticClass(), *Child->Name));
@@ -158,7 +756,14 @@ void AglTFRuntimeAlembicAssetActor::ProcessObject(USceneComponent* Component, TS
 		}
 		else if (Child->GetSchema() == "AbcGeom_Curve_v2")
 		{
-			ChildComponent = NewObject<UGroomComponent>(this, MakeUniqueObjectName(this, UGroomComponent::StaticClass(), *Child->Name));
+			if ((bPlayAnimation || bUseGeometryCache) && IsAnimatedCurves(*Child))
+			{
+				ChildComponent = NewObject<UglTFRuntimeAlembicGroomCacheComponent>(this, MakeUniqueObjectName(this, UglTFRuntimeAlembicGroomCacheComponent::StaticClass(), *Child->Name));
+			}
+			else
+			{
+				ChildComponent = NewObject<UGroomComponent>(this, MakeUniqueObjectName(this, UGroomComponent::StaticClass(), *Child->Name));
+			}
 		}
 		else if (Child->GetSchema() == "AbcGeom_Camera_v1")
 		{
@@ -169,12 +774,317 @@ void AglTFRuntimeAlembicAssetActor::ProcessObject(USceneComponent* Component, TS
 			ChildComponent = NewObject<USceneComponent>(this, MakeUniqueObjectName(this, USceneComponent::StaticClass(), *Child->Name));
 		}
 
+		if (!Offset.Equals(FTransform::Identity))
+		{
+			ChildComponent->SetRelativeTransform(Offset);
+			FlattenedOffsets.Add(ChildComponent, Offset);
+		}
+
 		ChildComponent->SetupAttachment(Component);
 		ChildComponent->RegisterComponent();
 		AddInstanceComponent(ChildComponent);
 
-		ProcessObject(ChildComponent, Child);
+		if (bAsyncLoading)
+		{
+			AsyncPendingObjects.Emplace(ChildComponent, Child);
+		}
+		else
+		{
+			ProcessObject(ChildComponent, Child);
+		}
+	}
+}
+
+bool AglTFRuntimeAlembicAssetActor::IsHiddenObject(const TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FVisibilityTrack>& InVisibilityTracks, const glTFRuntimeAlembic::FObject& Object, const bool bAllSamples, const int32 InSampleIndex)
+{
+	const glTFRuntimeAlembic::FVisibilityTrack* VisibilityTrack = InVisibilityTracks.Find(&Object);
+	if (!VisibilityTrack)
+	{
+		return false;
+	}
+
+	return bAllSamples ? VisibilityTrack->IsAlwaysHidden() : !VisibilityTrack->IsVisible(InSampleIndex);
+}
+
+bool AglTFRuntimeAlembicAssetActor::CanFlattenXform(const glTFRuntimeAlembic::FObject& Object, FTransform& Transform) const
+{
+	// objects that would become a plain scene component
+	const FString Schema = Object.GetSchema();
+	if (Schema == "AbcGeom_PolyMesh_v1" || Schema == "AbcGeom_Curve_v2" || Schema == "AbcGeom_Camera_v1" || Schema == "AbcGeom_FaceSet_v1" ||
+		SkeletalMeshObjectPaths.Contains(Object.Path) || MergedStaticMeshObjectPaths.Contains(Object.Path))
+	{
+		return false;
+	}
+
+	Transform = FTransform::Identity;
+
+	TSharedPtr<glTFRuntimeAlembic::FScalarProperty> OpsProperty = Object.FindScalarProperty(".xform/.ops");
+	TSharedPtr<glTFRuntimeAlembic::FScalarProperty> ValsProperty = Object.FindScalarProperty(".xform/.vals");
+	if (OpsProperty && ValsProperty)
+	{
+		auto IsStatic = [](const glTFRuntimeAlembic::FScalarProperty& Property)
+			{
+				return Property.NextSampleIndex <= 1 || (Property.FirstChangedIndex == 0 && Property.LastChangedIndex == 0);
+			};
+
+		if (!IsStatic(*OpsProperty) || !IsStatic(*ValsProperty))
+		{
+			return false;
+		}
+
+		// a non inheriting xform ignores its parents, it cannot be folded into them
+		if (TSharedPtr<glTFRuntimeAlembic::FScalarProperty> InheritsProperty = Object.FindScalarProperty(".xform/.inherits"))
+		{
+			uint8 bInherits = 1;
+			if (!IsStatic(*InheritsProperty) || !InheritsProperty->Get(0, 0, bInherits) || !bInherits)
+			{
+				return false;
+			}
+		}
+
+		if (!glTFRuntimeAlembic::BuildTransform(0, OpsProperty.ToSharedRef(), 0, ValsProperty.ToSharedRef(), Transform))
+		{
+			return false;
+		}
+		Transform = Asset->GetParser()->TransformTransform(Transform);
+	}
+
+	if (Transform.Equals(FTransform::Identity))
+	{
+		return true;
+	}
+
+	int32 NumChildren = 0;
+	for (const TSharedRef<glTFRuntimeAlembic::FObject>& Child : Object.Children)
+	{
+		if (Child->GetSchema() != "AbcGeom_FaceSet_v1")
+		{
+			NumChildren++;
+		}
+	}
+
+	return NumChildren == 1;
+}
+
+UStaticMesh* AglTFRuntimeAlembicAssetActor::LoadStaticMesh(const TSharedRef<glTFRuntimeAlembic::FObject>& Object)
+{
+	TArray<FglTFRuntimeMeshLOD> LODs;
+
+	// already built by the async task (directly or through an object with the same digest)
+	const glTFRuntimeAlembic::FObject* BuiltObject = &Object.Get();
+	if (const glTFRuntimeAlembic::FSampleDigest* Digest = MeshDigests.Find(BuiltObject))
+	{
+		if (const glTFRuntimeAlembic::FObject* const* Representative = AsyncMeshesRepresentatives.Find(*Digest))
+		{
+			BuiltObject = *Representative;
+		}
+	}
+
+	if (TArray<FglTFRuntimeMeshLOD>* AsyncLODs = AsyncMeshesLODs.Find(BuiltObject))
+	{
+		LODs = MoveTemp(*AsyncLODs);
+		AsyncMeshesLODs.Remove(BuiltObject);
+	}
+	else if (!LoadMeshLODs(Asset, *Object, SampleIndex, StaticMeshConfig.MaterialsConfig, AlembicConfig, LODs))
+	{
+		return nullptr;
+	}
+
+	FglTFRuntimeStaticMeshConfig LODsStaticMeshConfig = StaticMeshConfig;
+	for (int32 LODIndex = 1; LODIndex < LODs.Num(); LODIndex++)
+	{
+		if (AlembicConfig.LODs.IsValidIndex(LODIndex - 1) && AlembicConfig.LODs[LODIndex - 1].ScreenSize > 0)
+		{
+			LODsStaticMeshConfig.LODScreenSize.Add(LODIndex, AlembicConfig.LODs[LODIndex - 1].ScreenSize);
+		}
+	}
+
+	return Asset->LoadStaticMeshFromRuntimeLODs(LODs, LODsStaticMeshConfig);
+}
+
+bool AglTFRuntimeAlembicAssetActor::LoadMeshLODs(UglTFRuntimeAsset* InAsset, const glTFRuntimeAlembic::FObject& Object, const int32 InSampleIndex, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const FglTFRuntimeAlembicConfig& InAlembicConfig, TArray<FglTFRuntimeMeshLOD>& LODs)
+{
+	FglTFRuntimeMeshLOD LOD;
+	TArray<FglTFRuntimeMeshLOD> SimplifiedLODs;
+	if (!UglTFRuntimeABCFunctionLibrary::LoadRuntimeLODFromAlembicObject(InAsset, Object, InSampleIndex, LOD, MaterialsConfig, InAlembicConfig, nullptr, &SimplifiedLODs))
+	{
+		return false;
+	}
+
+	LODs.Reset();
+	LODs.Add(MoveTemp(LOD));
+	LODs.Append(MoveTemp(SimplifiedLODs));
+
+	return true;
+}
+
+bool AglTFRuntimeAlembicAssetActor::UpdateXform(USceneComponent* Component, const glTFRuntimeAlembic::FObject& Object, const int32 InSampleIndex, const FTransform& Offset)
+{
+	TSharedPtr<glTFRuntimeAlembic::FScalarProperty> MatrixOpsProperty = Object.FindScalarProperty(".xform/.ops");
+	TSharedPtr<glTFRuntimeAlembic::FScalarProperty> MatrixValsProperty = Object.FindScalarProperty(".xform/.vals");
+	if (!MatrixOpsProperty || !MatrixValsProperty)
+	{
+		return true;
+	}
+
+	uint32 MatrixOpsPropertyTrueSampleIndex;
+	if (!MatrixOpsProperty->GetSampleTrueIndex(InSampleIndex, MatrixOpsPropertyTrueSampleIndex))
+	{
+		return false;
+	}
+	uint32 MatrixValsPropertyTrueSampleIndex;
+	if (!MatrixValsProperty->GetSampleTrueIndex(InSampleIndex, MatrixValsPropertyTrueSampleIndex))
+	{
+		return false;
+	}
+
+	FTransform Transform;
+	if (glTFRuntimeAlembic::BuildTransform(MatrixOpsPropertyTrueSampleIndex, MatrixOpsProperty.ToSharedRef(), MatrixValsPropertyTrueSampleIndex, MatrixValsProperty.ToSharedRef(), Transform))
+	{
+		Component->SetRelativeTransform(Asset->GetParser()->TransformTransform(Transform) * Offset);
+	}
+
+	return true;
+}
+
+bool AglTFRuntimeAlembicAssetActor::IsAnimatedPolyMesh(const glTFRuntimeAlembic::FObject& Object)
+{
+	if (Object.GetSchema() != "AbcGeom_PolyMesh_v1")
+	{
+		return false;
+	}
+
+	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> PositionsProperty = Object.FindArrayProperty(".geom/P");
+	return PositionsProperty && PositionsProperty->LastChangedIndex > 0;
+}
+
+bool AglTFRuntimeAlembicAssetActor::IsAnimatedCurves(const glTFRuntimeAlembic::FObject& Object)
+{
+	if (Object.GetSchema() != "AbcGeom_Curve_v2")
+	{
+		return false;
+	}
+
+	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> PositionsProperty = Object.FindArrayProperty(".geom/P");
+	return PositionsProperty && PositionsProperty->LastChangedIndex > 0;
+}
+
+bool AglTFRuntimeAlembicAssetActor::IsLeafPolyMesh(const glTFRuntimeAlembic::FObject& Object)
+{
+	if (Object.GetSchema() != "AbcGeom_PolyMesh_v1")
+	{
+		return false;
+	}
+
+	for (const TSharedRef<glTFRuntimeAlembic::FObject>& Child : Object.Children)
+	{
+		if (Child->GetSchema() != "AbcGeom_FaceSet_v1")
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void AglTFRuntimeAlembicAssetActor::AddMergedStaticMeshes(USceneComponent* Component, const glTFRuntimeAlembic::FObject& Object)
+{
+	TArray<FglTFRuntimeMeshLOD> ChunksLODs;
+	if (TArray<FglTFRuntimeMeshLOD>* AsyncChunksLODs = AsyncMergedMeshesLODs.Find(&Object))
+	{
+		ChunksLODs = MoveTemp(*AsyncChunksLODs);
+		AsyncMergedMeshesLODs.Remove(&Object);
+	}
+	else if (!UglTFRuntimeABCFunctionLibrary::LoadMergedRuntimeLODsFromAlembicObject(Asset, Object, SampleIndex, ChunksLODs, StaticMeshConfig.MaterialsConfig, AlembicConfig, MergedStaticMeshChunkSize))
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to merge the polymeshes of %s"), *Object.Path);
+		return;
 	}
+
+	for (const FglTFRuntimeMeshLOD& ChunkLOD : ChunksLODs)
+	{
+		UStaticMesh* StaticMesh = Asset->LoadStaticMeshFromRuntimeLODs({ ChunkLOD }, StaticMeshConfig);
+		if (!StaticMesh)
+		{
+			continue;
+		}
+
+		UStaticMeshComponent* StaticMeshComponent = NewObject<UStaticMeshComponent>(this, MakeUniqueObjectName(this, UStaticMeshComponent::StaticClass(), *FString::Printf(TEXT("%s_Merged"), *Object.Name)));
+		StaticMeshComponent->SetStaticMesh(StaticMesh);
+		StaticMeshComponent->ComponentTags.Add(FName(FString::Printf(TEXT("glTFRuntimeAlembic::Object::Path::%s"), *Object.Path)));
+		StaticMeshComponent->SetupAttachment(Component);
+		StaticMeshComponent->RegisterComponent();
+		AddInstanceComponent(StaticMeshComponent);
+	}
+}
+
+void AglTFRuntimeAlembicAssetActor::CollectMeshDigests(const glTFRuntimeAlembic::FObject& Object, const TSet<FString>& SkeletalMeshPaths, const TSet<FString>& MergedPaths, const TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FVisibilityTrack>& InVisibilityTracks, const TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FXformTrack>& InXformTracks, const bool bSkipAnimated, const int32 InSampleIndex, TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FSampleDigest>& OutMeshDigests, TMap<glTFRuntimeAlembic::FSampleDigest, int32>& OutMeshDigestsCounters, const bool bAnimatedAncestor)
+{
+	// merged into a skeletal or static mesh
+	if (SkeletalMeshPaths.Contains(Object.Path) || MergedPaths.Contains(Object.Path))
+	{
+		return;
+	}
+
+	// instances cannot be hidden one by one (the visibility of the descendants is part of the track)
+	if (InVisibilityTracks.Contains(&Object))
+	{
+		return;
+	}
+
+	// instances are placed once in the AssetRoot space, so they cannot follow animated xforms
+	const glTFRuntimeAlembic::FXformTrack* Track = InXformTracks.Find(&Object);
+	const bool bAnimated = bAnimatedAncestor || (Track && Track->IsAnimated());
+
+	for (const TSharedRef<glTFRuntimeAlembic::FObject>& Child : Object.Children)
+	{
+		CollectMeshDigests(*Child, SkeletalMeshPaths, MergedPaths, InVisibilityTracks, InXformTracks, bSkipAnimated, InSampleIndex, OutMeshDigests, OutMeshDigestsCounters, bAnimated);
+	}
+
+	// animated polymeshes are streamed in playback mode
+	if (IsLeafPolyMesh(Object) && !bAnimated && !(bSkipAnimated && IsAnimatedPolyMesh(Object)))
+	{
+		glTFRuntimeAlembic::FSampleDigest Digest;
+		if (glTFRuntimeAlembic::GetMeshDigest(Object, InSampleIndex, Digest))
+		{
+			OutMeshDigests.Add(&Object, Digest);
+			OutMeshDigestsCounters.FindOrAdd(Digest)++;
+		}
+	}
+}
+
+bool AglTFRuntimeAlembicAssetActor::AddMeshInstance(USceneComponent* ParentComponent, const TSharedRef<glTFRuntimeAlembic::FObject>& Object, const FTransform& Offset)
+{
+	const glTFRuntimeAlembic::FSampleDigest* Digest = MeshDigests.Find(&Object.Get());
+	if (!Digest || MeshDigestsCounters.FindRef(*Digest) < 2)
+	{
+		return false;
+	}
+
+	// the first object with a given digest builds the mesh, the others just add an instance
+	UHierarchicalInstancedStaticMeshComponent* InstancedMeshComponent = InstancedMeshComponents.FindRef(*Digest);
+	if (!InstancedMeshComponent)
+	{
+		UStaticMesh* StaticMesh = LoadStaticMesh(Object);
+		if (!StaticMesh)
+		{
+			return false;
+		}
+
+		InstancedMeshComponent = NewObject<UHierarchicalInstancedStaticMeshComponent>(this, MakeUniqueObjectName(this, UHierarchicalInstancedStaticMeshComponent::StaticClass(), *Object->Name));
+		InstancedMeshComponent->SetStaticMesh(StaticMesh);
+		InstancedMeshComponent->ComponentTags.Add(FName(FString::Printf(TEXT("glTFRuntimeAlembic::Object::Name::%s"), *Object->Name)));
+		InstancedMeshComponent->SetupAttachment(AssetRoot);
+		InstancedMeshComponent->RegisterComponent();
+		AddInstanceComponent(InstancedMeshComponent);
+
+		InstancedMeshComponents.Add(*Digest, InstancedMeshComponent);
+	}
+
+	// instances live in the AssetRoot space, the parent xform has already been applied (the flattened ones have not)
+	InstancedMeshComponent->AddInstance((Offset * ParentComponent->GetComponentTransform()).GetRelativeTransform(AssetRoot->GetComponentTransform()));
+
+	return true;
 }
 
 void AglTFRuntimeAlembicAssetActor::ReceiveOnStaticMeshComponentCreated_Implementation(UStaticMeshComponent* StaticMeshComponent)
@@ -0,0 +1,202 @@
+// Copyright 2025 - Roberto De Ioris
+
+#include "glTFRuntimeAlembicGroomCacheComponent.h"
+#include "glTFRuntimeABCFunctionLibrary.h"
+#include "glTFRuntimeAlembicStreamingMeshComponent.h"
+#include "GroomAsset.h"
+#include "HairDescription.h"
+
+UglTFRuntimeAlembicGroomCacheComponent::UglTFRuntimeAlembicGroomCacheComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+}
+
+void UglTFRuntimeAlembicGroomCacheComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// the groom cache is assigned as soon as it is built, even when the samples are chosen from outside
+	if (bBuilding && BuildTask.IsCompleted())
+	{
+		FinishBuild();
+	}
+
+	if (!bPlaying || NumSamples <= 0 || FramesPerSecond <= 0)
+	{
+		return;
+	}
+
+	PlaybackTime += DeltaTime * PlayRate;
+
+	SetSampleIndex(glTFRuntimeAlembic::GetPlaybackSampleIndex(PlaybackTime, NumSamples, FramesPerSecond, bLooping));
+}
+
+void UglTFRuntimeAlembicGroomCacheComponent::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	WaitForBuild();
+
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+}
+
+void UglTFRuntimeAlembicGroomCacheComponent::BeginDestroy()
+{
+	WaitForBuild();
+
+	Super::BeginDestroy();
+}
+
+bool UglTFRuntimeAlembicGroomCacheComponent::OpenAlembicObject(UglTFRuntimeAsset* InAsset, const FString& ObjectPath)
+{
+	if (!InAsset)
+	{
+		return false;
+	}
+
+	TSharedPtr<glTFRuntimeAlembic::FObject> Root = glTFRuntimeAlembic::ParseArchive(InAsset->GetParser()->GetBlob());
+	if (!Root)
+	{
+		return false;
+	}
+
+	TSharedPtr<const glTFRuntimeAlembic::FObject> FoundObject = Root->Find(ObjectPath);
+	if (!FoundObject)
+	{
+		return false;
+	}
+
+	return OpenAlembicObject(InAsset, FoundObject.ToSharedRef());
+}
+
+bool UglTFRuntimeAlembicGroomCacheComponent::OpenAlembicObject(UglTFRuntimeAsset* InAsset, const TSharedRef<const glTFRuntimeAlembic::FObject>& InObject)
+{
+	if (!InAsset)
+	{
+		return false;
+	}
+
+	TSharedPtr<FHairDescription> NewHairDescription = MakeShared<FHairDescription>();
+	if (!UglTFRuntimeABCFunctionLibrary::LoadHairDescriptionFromAlembicObject(InAsset, *InObject, *NewHairDescription))
+	{
+		return false;
+	}
+
+	TSharedPtr<glTFRuntimeAlembic::FCompressedCurvesStore> NewCurvesStore = UglTFRuntimeABCFunctionLibrary::LoadCompressedCurvesStoreFromAlembicObject(*InObject, CompressedKeyframeInterval);
+	if (!NewCurvesStore)
+	{
+		return false;
+	}
+
+	return OpenCurvesStore(InAsset, NewCurvesStore.ToSharedRef(), NewHairDescription.ToSharedRef());
+}
+
+bool UglTFRuntimeAlembicGroomCacheComponent::OpenCurvesStore(UglTFRuntimeAsset* InAsset, const TSharedRef<const glTFRuntimeAlembic::FCompressedCurvesStore>& InCurvesStore, const TSharedRef<const FHairDescription>& InHairDescription)
+{
+	if (!InAsset || InCurvesStore->NumFrames() == 0 || InHairDescription->GetNumVertices() != InCurvesStore->GetOffsets().Last())
+	{
+		return false;
+	}
+
+	// no build task can be running while the source changes
+	WaitForBuild();
+
+	SetGroomCache(nullptr);
+	bGroomCacheReady = false;
+	NumSamples = 0;
+	DisplayedSampleIndex = INDEX_NONE;
+
+	// the groom is built only once (from the first sample), the groom cache moves its strands
+	FHairDescription FirstSampleHairDescription = *InHairDescription;
+	UGroomAsset* GroomAsset = UglTFRuntimeABCFunctionLibrary::LoadGroomFromHairDescription(MoveTemp(FirstSampleHairDescription), false);
+	if (!GroomAsset)
+	{
+		return false;
+	}
+
+	SetGroomAsset(GroomAsset);
+
+	Asset = InAsset;
+	NumSamples = InCurvesStore->NumFrames();
+	GroomCacheFramesPerSecond = FramesPerSecond > 0 ? FramesPerSecond : 24;
+	WantedSampleIndex = 0;
+	DisplayedSampleIndex = 0;
+
+	bBuilding = true;
+	BuildTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, Store = InCurvesStore, Template = InHairDescription, BuildAsset = InAsset, BlockSize = CompressedKeyframeInterval]()
+		{
+			TSharedPtr<FGroomCacheProcessor> Processor = MakeShared<FGroomCacheProcessor>(EGroomCacheType::Strands, EGroomCacheAttributes::Position);
+			if (UglTFRuntimeABCFunctionLibrary::LoadGroomCacheFramesFromCurvesStore(BuildAsset, *Store, *Template, BlockSize, *Processor))
+			{
+				BuiltProcessor = Processor;
+			}
+		});
+
+	SetSampleIndex(glTFRuntimeAlembic::GetPlaybackSampleIndex(PlaybackTime, NumSamples, FramesPerSecond, bLooping));
+
+	return true;
+}
+
+bool UglTFRuntimeAlembicGroomCacheComponent::SetSampleIndex(const int32 InSampleIndex)
+{
+	if (NumSamples <= 0)
+	{
+		return false;
+	}
+
+	WantedSampleIndex = FMath::Clamp(InSampleIndex, 0, NumSamples - 1);
+
+	if (bBuilding && BuildTask.IsCompleted())
+	{
+		FinishBuild();
+	}
+
+	if (!bGroomCacheReady)
+	{
+		return WantedSampleIndex == DisplayedSampleIndex;
+	}
+
+	ShowSample(WantedSampleIndex);
+
+	return true;
+}
+
+void UglTFRuntimeAlembicGroomCacheComponent::ShowSample(const int32 SampleIndex)
+{
+	if (SampleIndex != DisplayedSampleIndex)
+	{
+		TickAtThisTime(SampleIndex / GroomCacheFramesPerSecond, false, false, false);
+		DisplayedSampleIndex = SampleIndex;
+	}
+}
+
+void UglTFRuntimeAlembicGroomCacheComponent::FinishBuild()
+{
+	bBuilding = false;
+
+	UGroomCache* GroomCache = BuiltProcessor ? UglTFRuntimeABCFunctionLibrary::LoadGroomCacheFromProcessor(*BuiltProcessor, NumSamples, GroomCacheFramesPerSecond) : nullptr;
+	BuiltProcessor.Reset();
+
+	if (!GroomCache)
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to build the groom cache, only the first sample will be shown"));
+		return;
+	}
+
+	SetGroomCache(GroomCache);
+	// the time is driven by SetSampleIndex
+	SetManualTick(true);
+	bGroomCacheReady = true;
+
+	// the groom cache starts from its first frame
+	DisplayedSampleIndex = INDEX_NONE;
+	ShowSample(WantedSampleIndex);
+}
+
+void UglTFRuntimeAlembicGroomCacheComponent::WaitForBuild()
+{
+	if (bBuilding)
+	{
+		BuildTask.Wait();
+		BuiltProcessor.Reset();
+		bBuilding = false;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,741 @@
+// Copyright 2025 - Roberto De Ioris
+
+#include "glTFRuntimeAlembicStreamingMeshComponent.h"
+#include "glTFRuntimeABCFunctionLibrary.h"
+#include "glTFRuntimeAlembicStats.h"
+#include "Async/ParallelFor.h"
+#include "DynamicMesh/DynamicMeshAttributeSet.h"
+
+UglTFRuntimeAlembicStreamingMeshComponent::UglTFRuntimeAlembicStreamingMeshComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+}
+
+void UglTFRuntimeAlembicStreamingMeshComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!bPlaying || NumSamples <= 0 || FramesPerSecond <= 0)
+	{
+		return;
+	}
+
+	PlaybackTime += DeltaTime * PlayRate;
+
+	const int32 NewSampleIndex = glTFRuntimeAlembic::GetPlaybackSampleIndex(PlaybackTime, NumSamples, FramesPerSecond, bLooping);
+	SetSampleIndex(NewSampleIndex, PlayRate, bLooping, PlaybackTime * FramesPerSecond - NewSampleIndex);
+}
+
+void UglTFRuntimeAlembicStreamingMeshComponent::OnComponentDestroyed(bool bDestroyingHierarchy)
+{
+	WaitForSlots();
+
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
+}
+
+void UglTFRuntimeAlembicStreamingMeshComponent::BeginDestroy()
+{
+	WaitForSlots();
+
+	Super::BeginDestroy();
+}
+
+bool UglTFRuntimeAlembicStreamingMeshComponent::OpenAlembicObject(UglTFRuntimeAsset* InAsset, const FString& ObjectPath, const FglTFRuntimeMaterialsConfig& InMaterialsConfig, const FglTFRuntimeAlembicConfig& InAlembicConfig)
+{
+	if (!InAsset)
+	{
+		return false;
+	}
+
+	TSharedPtr<glTFRuntimeAlembic::FObject> Root = glTFRuntimeAlembic::ParseArchive(InAsset->GetParser()->GetBlob());
+	if (!Root)
+	{
+		return false;
+	}
+
+	TSharedPtr<const glTFRuntimeAlembic::FObject> FoundObject = Root->Find(ObjectPath);
+	if (!FoundObject)
+	{
+		return false;
+	}
+
+	return OpenAlembicObject(InAsset, FoundObject.ToSharedRef(), InMaterialsConfig, InAlembicConfig);
+}
+
+bool UglTFRuntimeAlembicStreamingMeshComponent::OpenAlembicObject(UglTFRuntimeAsset* InAsset, const TSharedRef<const glTFRuntimeAlembic::FObject>& InObject, const FglTFRuntimeMaterialsConfig& InMaterialsConfig, const FglTFRuntimeAlembicConfig& InAlembicConfig)
+{
+	return Open(InAsset, InObject, InMaterialsConfig, InAlembicConfig, nullptr);
+}
+
+bool UglTFRuntimeAlembicStreamingMeshComponent::OpenFrameStore(UglTFRuntimeAsset* InAsset, const TSharedRef<const glTFRuntimeAlembic::FObject>& InObject, const FglTFRuntimeMaterialsConfig& InMaterialsConfig, const FglTFRuntimeAlembicConfig& InAlembicConfig, const TSharedRef<const glTFRuntimeAlembic::FCompressedFrameStore>& InFrameStore)
+{
+	return Open(InAsset, InObject, InMaterialsConfig, InAlembicConfig, InFrameStore);
+}
+
+bool UglTFRuntimeAlembicStreamingMeshComponent::Open(UglTFRuntimeAsset* InAsset, const TSharedRef<const glTFRuntimeAlembic::FObject>& InObject, const FglTFRuntimeMaterialsConfig& InMaterialsConfig, const FglTFRuntimeAlembicConfig& InAlembicConfig, const TSharedPtr<const glTFRuntimeAlembic::FCompressedFrameStore>& InFrameStore)
+{
+	if (!InAsset)
+	{
+		return false;
+	}
+
+	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> PositionsProperty = InObject->FindArrayProperty(".geom/P");
+	if (!PositionsProperty)
+	{
+		return false;
+	}
+
+	if (InFrameStore && InFrameStore->NumFrames() != static_cast<int32>(PositionsProperty->NextSampleIndex))
+	{
+		UE_LOG(LogGLTFRuntime, Error, TEXT("The frame store of %s has %d frames for %u samples"), *InObject->Path, InFrameStore->NumFrames(), PositionsProperty->NextSampleIndex);
+		return false;
+	}
+
+	// no decode task can be running while the source changes
+	WaitForSlots();
+
+	Asset = InAsset;
+	Object = InObject;
+	MaterialsConfig = InMaterialsConfig;
+	AlembicConfig = InAlembicConfig;
+	NumSamples = PositionsProperty->NextSampleIndex;
+	DisplayedSampleIndex = INDEX_NONE;
+	MissedSampleIndex = INDEX_NONE;
+	DisplayedVersion = glTFRuntimeAlembic::FMeshSampleVersion();
+	DisplayedMeshLayout = glTFRuntimeAlembic::FDynamicMeshVertexLayout();
+
+	{
+		FScopeLock TopologyCacheLock(&TopologyCache.Lock);
+		TopologyCache.Topology.Reset();
+		TopologyCache.LODsTangents.Empty();
+	}
+
+	ResetSlots();
+
+	FrameStore = InFrameStore;
+	if (!FrameStore && bCompressFrames)
+	{
+		FrameStore = UglTFRuntimeABCFunctionLibrary::LoadCompressedFrameStoreFromAlembicObject(Asset, *Object, MaterialsConfig, AlembicConfig, CompressedKeyframeInterval, &TopologyCache);
+		if (!FrameStore)
+		{
+			UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to compress the samples of %s, they will be decoded from the archive"), *Object->Path);
+		}
+	}
+
+	// start prefetching from the current time
+	SetSampleIndex(glTFRuntimeAlembic::GetPlaybackSampleIndex(PlaybackTime, NumSamples, FramesPerSecond, bLooping), PlayRate, bLooping);
+
+	return true;
+}
+
+int32 UglTFRuntimeAlembicStreamingMeshComponent::GetNumSamples() const
+{
+	return NumSamples;
+}
+
+float UglTFRuntimeAlembicStreamingMeshComponent::GetCompressionRatio() const
+{
+	return FrameStore ? FrameStore->GetCompressionRatio() : 0;
+}
+
+float UglTFRuntimeAlembicStreamingMeshComponent::GetDecodeThroughput() const
+{
+	return FrameStore ? FrameStore->GetDecodeThroughput() : 0;
+}
+
+bool UglTFRuntimeAlembicStreamingMeshComponent::SetSampleIndex(const int32 InSampleIndex, const float InPlayRate, const bool bInLooping, const float InSampleAlpha)
+{
+	if (!Object || NumSamples <= 0)
+	{
+		return false;
+	}
+
+	if (Slots.Num() != FMath::Max(PrefetchWindow, 1))
+	{
+		ResetSlots();
+	}
+
+	auto GetSample = [this, bInLooping](const int32 UnboundSampleIndex, int32& BoundSampleIndex)
+		{
+			if (bInLooping)
+			{
+				BoundSampleIndex = ((UnboundSampleIndex % NumSamples) + NumSamples) % NumSamples;
+				return true;
+			}
+
+			BoundSampleIndex = UnboundSampleIndex;
+			return UnboundSampleIndex >= 0 && UnboundSampleIndex < NumSamples;
+		};
+
+	int32 CurrentSampleIndex;
+	if (!GetSample(InSampleIndex, CurrentSampleIndex))
+	{
+		CurrentSampleIndex = FMath::Clamp(InSampleIndex, 0, NumSamples - 1);
+	}
+
+	// the window follows the playback direction, faster rates skip samples
+	const int32 Direction = InPlayRate < 0 ? -1 : 1;
+	const int32 Step = FMath::Max(FMath::FloorToInt32(FMath::Abs(InPlayRate)), 1);
+
+	TArray<int32, TInlineAllocator<16>> WantedSamples;
+	for (int32 Offset = 0; Offset < Slots.Num(); Offset++)
+	{
+		int32 WantedSampleIndex;
+		if (GetSample(CurrentSampleIndex + Offset * Step * Direction, WantedSampleIndex) && WantedSampleIndex != DisplayedSampleIndex)
+		{
+			WantedSamples.AddUnique(WantedSampleIndex);
+		}
+	}
+
+	// interpolation always blends towards the following sample, whatever the playback direction
+	int32 NextSampleIndex = INDEX_NONE;
+	if (bInterpolateSamples && GetSample(CurrentSampleIndex + 1, NextSampleIndex) && !WantedSamples.Contains(NextSampleIndex))
+	{
+		WantedSamples.Insert(NextSampleIndex, FMath::Min(WantedSamples.Num(), 1));
+	}
+
+	// decoded samples out of the window are dropped, the ones still decoding are left to complete
+	for (const TUniquePtr<FSlot>& Slot : Slots)
+	{
+		if (Slot->State == ESlotState::Ready && !WantedSamples.Contains(Slot->SampleIndex))
+		{
+			Slot->SampleIndex = INDEX_NONE;
+			Slot->State = ESlotState::Free;
+		}
+	}
+
+	// nearest samples first
+	for (const int32 WantedSampleIndex : WantedSamples)
+	{
+		if (IsSampleQueued(WantedSampleIndex))
+		{
+			continue;
+		}
+
+		const TUniquePtr<FSlot>* FreeSlot = Slots.FindByPredicate([](const TUniquePtr<FSlot>& Slot) { return Slot->State == ESlotState::Free; });
+		if (!FreeSlot)
+		{
+			break;
+		}
+
+		DecodeSample(**FreeSlot, WantedSampleIndex);
+	}
+
+	if (DisplayedSampleIndex != CurrentSampleIndex)
+	{
+		const TUniquePtr<FSlot>* CurrentSlot = Slots.FindByPredicate([CurrentSampleIndex](const TUniquePtr<FSlot>& Slot) { return Slot->SampleIndex == CurrentSampleIndex && Slot->State == ESlotState::Ready; });
+		if (!CurrentSlot)
+		{
+			// the previous sample stays visible until the decode completes
+			if (MissedSampleIndex != CurrentSampleIndex)
+			{
+				INC_DWORD_STAT(STAT_glTFRuntimeAlembic_MissedPrefetches);
+				MissedSampleIndex = CurrentSampleIndex;
+			}
+			return false;
+		}
+
+		DisplaySlot(**CurrentSlot);
+	}
+
+	if (bInterpolateSamples)
+	{
+		InterpolateDisplayedSlot(NextSampleIndex, InSampleAlpha);
+	}
+
+	return true;
+}
+
+void UglTFRuntimeAlembicStreamingMeshComponent::InterpolateDisplayedSlot(const int32 NextSampleIndex, const float InSampleAlpha)
+{
+	if (!DisplayedSlot)
+	{
+		return;
+	}
+
+	const float Alpha = FMath::Clamp(InSampleAlpha, 0.0f, 1.0f);
+	if (FMath::IsNearlyEqual(Alpha, DisplayedSampleAlpha, 0.001f))
+	{
+		return;
+	}
+
+	if (Alpha > 0)
+	{
+		// wait for the next sample (the current one stays visible)
+		const TUniquePtr<FSlot>* NextSlot = Slots.FindByPredicate([NextSampleIndex](const TUniquePtr<FSlot>& Slot) { return Slot->SampleIndex == NextSampleIndex && Slot->State == ESlotState::Ready && Slot->bValid; });
+		if (!NextSlot)
+		{
+			return;
+		}
+
+		// blend straight into the displayed mesh, the interpolated LOD is built only when the mesh cannot be updated in place
+		if (!LerpMeshVertices(DisplayedSlot->LOD, (*NextSlot)->LOD, Alpha))
+		{
+			// the topology changed, the mesh will just snap to the next sample
+			FglTFRuntimeMeshLOD InterpolatedLOD;
+			if (!glTFRuntimeAlembic::LerpRuntimeLODs(DisplayedSlot->LOD, (*NextSlot)->LOD, Alpha, InterpolatedLOD))
+			{
+				return;
+			}
+
+			ShowRuntimeLOD(InterpolatedLOD);
+		}
+	}
+	else
+	{
+		ShowRuntimeLOD(DisplayedSlot->LOD);
+	}
+
+	DisplayedSampleAlpha = Alpha;
+}
+
+bool UglTFRuntimeAlembicStreamingMeshComponent::UpdateMeshVertices(const FglTFRuntimeMeshLOD& RuntimeLOD, const bool bPositions, const bool bNormals)
+{
+	if (!bUpdateVerticesInPlace || DisplayedMeshLayout.NumVertices == 0)
+	{
+		return false;
+	}
+
+	if (!bPositions && !bNormals)
+	{
+		return true;
+	}
+
+	bool bUpdated = false;
+	GetDynamicMesh()->EditMesh([&](UE::Geometry::FDynamicMesh3& EditMesh)
+		{
+			bUpdated = glTFRuntimeAlembic::UpdateDynamicMeshVertices(RuntimeLOD, DisplayedMeshLayout, EditMesh, bPositions, bNormals);
+		}, EDynamicMeshChangeType::DeformationEdit, EDynamicMeshAttributeChangeFlags::VertexPositions | EDynamicMeshAttributeChangeFlags::NormalsTangents, true);
+
+	if (!bUpdated)
+	{
+		return false;
+	}
+
+	// only the vertex buffers are uploaded again
+	FastNotifyPositionsUpdated(bNormals);
+	INC_DWORD_STAT(STAT_glTFRuntimeAlembic_InPlaceMeshUpdates);
+
+	return true;
+}
+
+bool UglTFRuntimeAlembicStreamingMeshComponent::LerpMeshVertices(const FglTFRuntimeMeshLOD& From, const FglTFRuntimeMeshLOD& To, const float Alpha)
+{
+	if (!bUpdateVerticesInPlace || DisplayedMeshLayout.NumVertices == 0)
+	{
+		return false;
+	}
+
+	bool bUpdated = false;
+	GetDynamicMesh()->EditMesh([&](UE::Geometry::FDynamicMesh3& EditMesh)
+		{
+			bUpdated = glTFRuntimeAlembic::LerpDynamicMeshVertices(From, To, Alpha, DisplayedMeshLayout, EditMesh);
+		}, EDynamicMeshChangeType::DeformationEdit, EDynamicMeshAttributeChangeFlags::VertexPositions | EDynamicMeshAttributeChangeFlags::NormalsTangents, true);
+
+	if (!bUpdated)
+	{
+		return false;
+	}
+
+	FastNotifyPositionsUpdated(true);
+	INC_DWORD_STAT(STAT_glTFRuntimeAlembic_InPlaceMeshUpdates);
+
+	return true;
+}
+
+void UglTFRuntimeAlembicStreamingMeshComponent::ShowRuntimeLOD(const FglTFRuntimeMeshLOD& RuntimeLOD)
+{
+	if (UpdateMeshVertices(RuntimeLOD, true, true))
+	{
+		return;
+	}
+
+	UE::Geometry::FDynamicMesh3 Mesh;
+	glTFRuntimeAlembic::BuildDynamicMesh(RuntimeLOD, Mesh, &DisplayedMeshLayout);
+	SetMesh(MoveTemp(Mesh));
+}
+
+void UglTFRuntimeAlembicStreamingMeshComponent::ResetSlots()
+{
+	WaitForSlots();
+
+	DisplayedSlot = nullptr;
+	Slots.Reset();
+	for (int32 SlotIndex = 0; SlotIndex < FMath::Max(PrefetchWindow, 1); SlotIndex++)
+	{
+		Slots.Add(MakeUnique<FSlot>());
+	}
+}
+
+void UglTFRuntimeAlembicStreamingMeshComponent::WaitForSlots()
+{
+	for (const TUniquePtr<FSlot>& Slot : Slots)
+	{
+		if (Slot->Task.IsValid())
+		{
+			Slot->Task.Wait();
+		}
+	}
+}
+
+bool UglTFRuntimeAlembicStreamingMeshComponent::IsSampleQueued(const int32 InSampleIndex) const
+{
+	return Slots.ContainsByPredicate([InSampleIndex](const TUniquePtr<FSlot>& Slot) { return Slot->State != ESlotState::Free && Slot->SampleIndex == InSampleIndex; });
+}
+
+void UglTFRuntimeAlembicStreamingMeshComponent::DecodeSample(FSlot& Slot, const int32 InSampleIndex)
+{
+	Slot.SampleIndex = InSampleIndex;
+	Slot.State = ESlotState::Decoding;
+
+	// samples sharing the topology of the displayed one will most likely update it in place, so their mesh is built only if really needed
+	const glTFRuntimeAlembic::FMeshSampleVersion SkipMeshVersion = bUpdateVerticesInPlace ? DisplayedVersion : glTFRuntimeAlembic::FMeshSampleVersion();
+
+	// the slot is owned by the component, which waits for its tasks before being destroyed
+	Slot.Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [this, &Slot, InSampleIndex, SlotFrameStore = FrameStore, SkipMeshVersion]()
+		{
+			Slot.LOD = FglTFRuntimeMeshLOD();
+			Slot.bHasMesh = false;
+			if (!glTFRuntimeAlembic::GetMeshSampleVersion(*Object, InSampleIndex, Slot.Version))
+			{
+				Slot.Version = glTFRuntimeAlembic::FMeshSampleVersion();
+			}
+			if (SlotFrameStore)
+			{
+				Slot.bValid = SlotFrameStore->DecodeFrame(InSampleIndex, Slot.LOD);
+			}
+			else
+			{
+				Slot.bValid = UglTFRuntimeABCFunctionLibrary::LoadRuntimeLODFromAlembicObject(Asset, *Object, InSampleIndex, Slot.LOD, MaterialsConfig, AlembicConfig, &TopologyCache);
+			}
+			if (Slot.bValid && !Slot.Version.HasSameTopology(SkipMeshVersion))
+			{
+				glTFRuntimeAlembic::BuildDynamicMesh(Slot.LOD, Slot.Mesh, &Slot.MeshLayout);
+				Slot.bHasMesh = true;
+			}
+			Slot.State = ESlotState::Ready;
+		});
+}
+
+void UglTFRuntimeAlembicStreamingMeshComponent::DisplaySlot(FSlot& Slot)
+{
+	if (Slot.bValid)
+	{
+		// an interpolated mesh does not match the positions and normals of its version anymore
+		const bool bSameTopology = Slot.Version.HasSameTopology(DisplayedVersion);
+		const bool bPositions = !Slot.Version.HasSamePositions(DisplayedVersion) || DisplayedSampleAlpha > 0;
+		const bool bNormals = !Slot.Version.HasSameNormals(DisplayedVersion) || DisplayedSampleAlpha > 0;
+		if (!bSameTopology || !UpdateMeshVertices(Slot.LOD, bPositions, bNormals))
+		{
+			if (!Slot.bHasMesh)
+			{
+				glTFRuntimeAlembic::BuildDynamicMesh(Slot.LOD, Slot.Mesh, &Slot.MeshLayout);
+			}
+			SetMesh(MoveTemp(Slot.Mesh));
+			DisplayedMeshLayout = MoveTemp(Slot.MeshLayout);
+		}
+		Slot.bHasMesh = false;
+		DisplayedVersion = Slot.Version;
+
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < Slot.LOD.Primitives.Num(); PrimitiveIndex++)
+		{
+			UMaterialInterface* Material = Slot.LOD.Primitives[PrimitiveIndex].Material;
+			if (Material && GetMaterial(PrimitiveIndex) != Material)
+			{
+				SetMaterial(PrimitiveIndex, Material);
+			}
+		}
+	}
+	else
+	{
+		UE_LOG(LogGLTFRuntime, Warning, TEXT("Unable to load sample %d from %s"), Slot.SampleIndex, *Object->Path);
+	}
+
+	DisplayedSampleIndex = Slot.SampleIndex;
+	DisplayedSampleAlpha = 0;
+
+	if (DisplayedSlot)
+	{
+		DisplayedSlot->SampleIndex = INDEX_NONE;
+		DisplayedSlot->State = ESlotState::Free;
+		DisplayedSlot = nullptr;
+	}
+
+	// when interpolating the LOD is kept as the blend source, otherwise the slot can be reused
+	if (bInterpolateSamples && Slot.bValid)
+	{
+		Slot.State = ESlotState::Displayed;
+		DisplayedSlot = &Slot;
+	}
+	else
+	{
+		Slot.SampleIndex = INDEX_NONE;
+		Slot.State = ESlotState::Free;
+	}
+}
+
+namespace glTFRuntimeAlembic
+{
+	int32 GetPlaybackSampleIndex(float& PlaybackTime, const int32 NumSamples, const float FramesPerSecond, const bool bLooping)
+	{
+		if (NumSamples <= 0 || FramesPerSecond <= 0)
+		{
+			return 0;
+		}
+
+		const float Duration = NumSamples / FramesPerSecond;
+		if (bLooping)
+		{
+			PlaybackTime = FMath::Fmod(PlaybackTime, Duration);
+			if (PlaybackTime < 0)
+			{
+				PlaybackTime += Duration;
+			}
+		}
+		else
+		{
+			PlaybackTime = FMath::Clamp(PlaybackTime, 0.0f, Duration);
+		}
+
+		return FMath::Clamp(FMath::FloorToInt32(PlaybackTime * FramesPerSecond), 0, NumSamples - 1);
+	}
+
+	bool LerpRuntimeLODs(const FglTFRuntimeMeshLOD& From, const FglTFRuntimeMeshLOD& To, const float Alpha, FglTFRuntimeMeshLOD& RuntimeLOD)
+	{
+		if (From.Primitives.Num() != To.Primitives.Num())
+		{
+			return false;
+		}
+
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < From.Primitives.Num(); PrimitiveIndex++)
+		{
+			const FglTFRuntimePrimitive& FromPrimitive = From.Primitives[PrimitiveIndex];
+			const FglTFRuntimePrimitive& ToPrimitive = To.Primitives[PrimitiveIndex];
+			if (FromPrimitive.Positions.Num() != ToPrimitive.Positions.Num() || FromPrimitive.Normals.Num() != ToPrimitive.Normals.Num() || FromPrimitive.Indices != ToPrimitive.Indices)
+			{
+				return false;
+			}
+		}
+
+		RuntimeLOD = From;
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < RuntimeLOD.Primitives.Num(); PrimitiveIndex++)
+		{
+			FglTFRuntimePrimitive& Primitive = RuntimeLOD.Primitives[PrimitiveIndex];
+			const FglTFRuntimePrimitive& ToPrimitive = To.Primitives[PrimitiveIndex];
+
+			LerpPositions(Primitive.Positions, ToPrimitive.Positions, Alpha, Primitive.Positions);
+			LerpPositions(Primitive.Normals, ToPrimitive.Normals, Alpha, Primitive.Normals);
+			for (FVector& Normal : Primitive.Normals)
+			{
+				Normal = Normal.GetSafeNormal();
+			}
+		}
+
+		return true;
+	}
+
+	void BuildDynamicMesh(const FglTFRuntimeMeshLOD& RuntimeLOD, UE::Geometry::FDynamicMesh3& Mesh, FDynamicMeshVertexLayout* Layout)
+	{
+		using namespace UE::Geometry;
+
+		if (Layout)
+		{
+			*Layout = FDynamicMeshVertexLayout();
+		}
+
+		Mesh.Clear();
+		Mesh.EnableTriangleGroups();
+		Mesh.EnableAttributes();
+
+		int32 NumUVLayers = 0;
+		for (const FglTFRuntimePrimitive& Primitive : RuntimeLOD.Primitives)
+		{
+			NumUVLayers = FMath::Max(NumUVLayers, Primitive.UVs.Num());
+		}
+
+		FDynamicMeshAttributeSet* Attributes = Mesh.Attributes();
+		Attributes->SetNumUVLayers(NumUVLayers);
+		Attributes->EnableMaterialID();
+
+		FDynamicMeshNormalOverlay* Normals = Attributes->PrimaryNormals();
+		FDynamicMeshMaterialAttribute* MaterialIDs = Attributes->GetMaterialID();
+
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < RuntimeLOD.Primitives.Num(); PrimitiveIndex++)
+		{
+			const FglTFRuntimePrimitive& Primitive = RuntimeLOD.Primitives[PrimitiveIndex];
+
+			// vertices, normals and uvs elements are appended in the same order, so they share the primitive local index
+			const int32 FirstVertexID = Mesh.MaxVertexID();
+			const int32 FirstNormalID = Normals->MaxElementID();
+			TArray<int32, TInlineAllocator<4>> FirstUVIDs;
+
+			if (Layout)
+			{
+				Layout->PrimitivesFirstVertexID.Add(FirstVertexID);
+				Layout->PrimitivesFirstNormalID.Add(FirstNormalID);
+				Layout->PrimitivesNumVertices.Add(Primitive.Positions.Num());
+			}
+
+			for (int32 VertexIndex = 0; VertexIndex < Primitive.Positions.Num(); VertexIndex++)
+			{
+				Mesh.AppendVertex(Primitive.Positions[VertexIndex]);
+				Normals->AppendElement(FVector3f(Primitive.Normals.IsValidIndex(VertexIndex) ? Primitive.Normals[VertexIndex] : FVector::UpVector));
+			}
+
+			for (int32 UVIndex = 0; UVIndex < NumUVLayers; UVIndex++)
+			{
+				FDynamicMeshUVOverlay* UVs = Attributes->GetUVLayer(UVIndex);
+				FirstUVIDs.Add(UVs->MaxElementID());
+				for (int32 VertexIndex = 0; VertexIndex < Primitive.Positions.Num(); VertexIndex++)
+				{
+					const bool bHasUV = Primitive.UVs.IsValidIndex(UVIndex) && Primitive.UVs[UVIndex].IsValidIndex(VertexIndex);
+					UVs->AppendElement(FVector2f(bHasUV ? Primitive.UVs[UVIndex][VertexIndex] : FVector2D::ZeroVector));
+				}
+			}
+
+			for (int32 Index = 0; Index + 2 < Primitive.Indices.Num(); Index += 3)
+			{
+				const FIndex3i Corners(Primitive.Indices[Index], Primitive.Indices[Index + 1], Primitive.Indices[Index + 2]);
+				if (Corners.A >= Primitive.Positions.Num() || Corners.B >= Primitive.Positions.Num() || Corners.C >= Primitive.Positions.Num())
+				{
+					continue;
+				}
+
+				int32 TriangleID = Mesh.AppendTriangle(FIndex3i(FirstVertexID + Corners.A, FirstVertexID + Corners.B, FirstVertexID + Corners.C), PrimitiveIndex);
+				if (TriangleID == FDynamicMesh3::NonManifoldID)
+				{
+					// non manifold edges get their own copy of the vertices
+					FIndex3i SplitCorners;
+					for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+					{
+						SplitCorners[CornerIndex] = Mesh.AppendVertex(Mesh.GetVertex(FirstVertexID + Corners[CornerIndex]));
+						if (Layout)
+						{
+							Layout->SplitVertices.Add(TPair<int32, int32>(SplitCorners[CornerIndex], FirstVertexID + Corners[CornerIndex]));
+						}
+					}
+					TriangleID = Mesh.AppendTriangle(SplitCorners, PrimitiveIndex);
+				}
+
+				if (TriangleID < 0)
+				{
+					continue;
+				}
+
+				Normals->SetTriangle(TriangleID, FIndex3i(FirstNormalID + Corners.A, FirstNormalID + Corners.B, FirstNormalID + Corners.C));
+				for (int32 UVIndex = 0; UVIndex < NumUVLayers; UVIndex++)
+				{
+					Attributes->GetUVLayer(UVIndex)->SetTriangle(TriangleID, FIndex3i(FirstUVIDs[UVIndex] + Corners.A, FirstUVIDs[UVIndex] + Corners.B, FirstUVIDs[UVIndex] + Corners.C));
+				}
+				MaterialIDs->SetValue(TriangleID, PrimitiveIndex);
+			}
+		}
+
+		if (Layout)
+		{
+			Layout->NumVertices = Mesh.MaxVertexID();
+			Layout->NumNormals = Normals->MaxElementID();
+		}
+	}
+
+	bool LerpDynamicMeshVertices(const FglTFRuntimeMeshLOD& From, const FglTFRuntimeMeshLOD& To, const float Alpha, const FDynamicMeshVertexLayout& Layout, UE::Geometry::FDynamicMesh3& Mesh)
+	{
+		using namespace UE::Geometry;
+
+		FDynamicMeshNormalOverlay* Normals = Mesh.HasAttributes() ? Mesh.Attributes()->PrimaryNormals() : nullptr;
+		if (From.Primitives.Num() != Layout.PrimitivesNumVertices.Num() || To.Primitives.Num() != From.Primitives.Num() || Mesh.MaxVertexID() != Layout.NumVertices || !Normals || Normals->MaxElementID() != Layout.NumNormals)
+		{
+			return false;
+		}
+
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < From.Primitives.Num(); PrimitiveIndex++)
+		{
+			const FglTFRuntimePrimitive& FromPrimitive = From.Primitives[PrimitiveIndex];
+			const FglTFRuntimePrimitive& ToPrimitive = To.Primitives[PrimitiveIndex];
+			if (FromPrimitive.Positions.Num() != Layout.PrimitivesNumVertices[PrimitiveIndex] || ToPrimitive.Positions.Num() != FromPrimitive.Positions.Num() || ToPrimitive.Normals.Num() != FromPrimitive.Normals.Num() || ToPrimitive.Indices != FromPrimitive.Indices)
+			{
+				return false;
+			}
+		}
+
+		// every vertex and normal element is written by a single worker
+		constexpr int32 ChunkSize = 4 * 1024;
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < From.Primitives.Num(); PrimitiveIndex++)
+		{
+			const FglTFRuntimePrimitive& FromPrimitive = From.Primitives[PrimitiveIndex];
+			const FglTFRuntimePrimitive& ToPrimitive = To.Primitives[PrimitiveIndex];
+			const int32 FirstVertexID = Layout.PrimitivesFirstVertexID[PrimitiveIndex];
+			const int32 FirstNormalID = Layout.PrimitivesFirstNormalID[PrimitiveIndex];
+			const int32 NumVertices = FromPrimitive.Positions.Num();
+
+			ParallelFor(FMath::DivideAndRoundUp(NumVertices, ChunkSize), [&](const int32 ChunkIndex)
+				{
+					const int32 LastVertexIndex = FMath::Min((ChunkIndex + 1) * ChunkSize, NumVertices);
+					for (int32 VertexIndex = ChunkIndex * ChunkSize; VertexIndex < LastVertexIndex; VertexIndex++)
+					{
+						Mesh.SetVertex(FirstVertexID + VertexIndex, FMath::Lerp(FromPrimitive.Positions[VertexIndex], ToPrimitive.Positions[VertexIndex], static_cast<double>(Alpha)));
+						const FVector Normal = FromPrimitive.Normals.IsValidIndex(VertexIndex) ? FMath::Lerp(FromPrimitive.Normals[VertexIndex], ToPrimitive.Normals[VertexIndex], static_cast<double>(Alpha)).GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector) : FVector::UpVector;
+						Normals->SetElement(FirstNormalID + VertexIndex, FVector3f(Normal));
+					}
+				});
+		}
+
+		// split vertices share the normal elements of the originals
+		for (const TPair<int32, int32>& SplitVertex : Layout.SplitVertices)
+		{
+			Mesh.SetVertex(SplitVertex.Key, Mesh.GetVertex(SplitVertex.Value));
+		}
+
+		return true;
+	}
+
+	bool UpdateDynamicMeshVertices(const FglTFRuntimeMeshLOD& RuntimeLOD, const FDynamicMeshVertexLayout& Layout, UE::Geometry::FDynamicMesh3& Mesh, const bool bPositions, const bool bNormals)
+	{
+		using namespace UE::Geometry;
+
+		FDynamicMeshNormalOverlay* Normals = Mesh.HasAttributes() ? Mesh.Attributes()->PrimaryNormals() : nullptr;
+		if (RuntimeLOD.Primitives.Num() != Layout.PrimitivesNumVertices.Num() || Mesh.MaxVertexID() != Layout.NumVertices || !Normals || Normals->MaxElementID() != Layout.NumNormals)
+		{
+			return false;
+		}
+
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < RuntimeLOD.Primitives.Num(); PrimitiveIndex++)
+		{
+			if (RuntimeLOD.Primitives[PrimitiveIndex].Positions.Num() != Layout.PrimitivesNumVertices[PrimitiveIndex])
+			{
+				return false;
+			}
+		}
+
+		for (int32 PrimitiveIndex = 0; PrimitiveIndex < RuntimeLOD.Primitives.Num(); PrimitiveIndex++)
+		{
+			const FglTFRuntimePrimitive& Primitive = RuntimeLOD.Primitives[PrimitiveIndex];
+			const int32 FirstVertexID = Layout.PrimitivesFirstVertexID[PrimitiveIndex];
+			const int32 FirstNormalID = Layout.PrimitivesFirstNormalID[PrimitiveIndex];
+
+			for (int32 VertexIndex = 0; VertexIndex < Primitive.Positions.Num(); VertexIndex++)
+			{
+				if (bPositions)
+				{
+					Mesh.SetVertex(FirstVertexID + VertexIndex, Primitive.Positions[VertexIndex]);
+				}
+
+				if (bNormals)
+				{
+					Normals->SetElement(FirstNormalID + VertexIndex, FVector3f(Primitive.Normals.IsValidIndex(VertexIndex) ? Primitive.Normals[VertexIndex] : FVector::UpVector));
+				}
+			}
+		}
+
+		// split vertices share the normal elements of the originals
+		if (bPositions)
+		{
+			for (const TPair<int32, int32>& SplitVertex : Layout.SplitVertices)
+			{
+				Mesh.SetVertex(SplitVertex.Key, Mesh.GetVertex(SplitVertex.Value));
+			}
+		}
+
+		return true;
+	}
+}
\ No newline at end of file
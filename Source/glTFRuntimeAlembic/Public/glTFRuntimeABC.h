@@ -154,6 +154,35 @@ namespace glTFRuntimeAlembic
 
 	GLTFRUNTIMEALEMBIC_API TSharedPtr<IOgawaNode> ParseOgawaBlob(const TArrayView64<uint8>& Blob);
 
+	// the 16 bytes key Alembic stores in front of every sample: identical data means identical digest
+	struct FSampleDigest
+	{
+		uint64 Low = 0;
+		uint64 High = 0;
+
+		bool operator==(const FSampleDigest& Other) const
+		{
+			return Low == Other.Low && High == Other.High;
+		}
+
+		bool operator!=(const FSampleDigest& Other) const
+		{
+			return !(*this == Other);
+		}
+
+		// order dependent mix of multiple digests
+		void Combine(const FSampleDigest& Other)
+		{
+			Low = (Low * 0x100000001B3ULL) ^ Other.Low;
+			High = (High * 0x100000001B3ULL) ^ Other.High;
+		}
+
+		friend uint32 GetTypeHash(const FSampleDigest& Digest)
+		{
+			return GetTypeHash(Digest.Low ^ Digest.High);
+		}
+	};
+
 	struct GLTFRUNTIMEALEMBIC_API IProperty : public TSharedFromThis<IProperty>
 	{
 		IProperty(const FString& InName, const TMap<FString, FString>& InMetadata, const bool bInIsCompound) : Name(InName), Metadata(InMetadata), bIsCompound(bInIsCompound)
@@ -464,6 +493,79 @@ namespace glTFRuntimeAlembic
 			return true;
 		}
 
+		// all the Extent values of a sample with a single data lookup and type dispatch (Values must hold at least Extent elements)
+		template<typename T>
+		bool GetExtent(const uint32 TrueSampleIndex, const TArrayView<T> Values)
+		{
+			if (PODSize == 0 || Values.Num() < Extent)
+			{
+				return false;
+			}
+
+			const TSharedPtr<FOgawaData> Data = Group->GetData(TrueSampleIndex);
+			// skip initial hash
+			if (!Data || Data->Num() < 16 + PODSize * Extent)
+			{
+				return false;
+			}
+
+			const uint8* Payload = Data->Data.GetData() + 16;
+
+			switch (PODType)
+			{
+			case EglTFRuntimeAlembicPODType::Boolean:
+			case EglTFRuntimeAlembicPODType::Uint8:
+				CastValues<uint8>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Float16:
+				CastValues<FFloat16>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Float32:
+				CastValues<float>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Float64:
+				CastValues<double>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Int8:
+				CastValues<int8>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Uint16:
+				CastValues<uint16>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Int16:
+				CastValues<int16>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Uint32:
+				CastValues<uint32>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Int32:
+				CastValues<int32>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Uint64:
+				CastValues<uint64>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Int64:
+				CastValues<int64>(Payload, Values);
+				return true;
+			default:
+				break;
+			}
+
+			return false;
+		}
+
+		template<typename T, typename U>
+		void CastValues(const uint8* Payload, const TArrayView<U> Values) const
+		{
+			for (uint8 ExtentIndex = 0; ExtentIndex < Extent; ExtentIndex++)
+			{
+				// the payload is not guaranteed to be aligned
+				T Value;
+				FMemory::Memcpy(&Value, Payload + ExtentIndex * sizeof(T), sizeof(T));
+				Values[ExtentIndex] = static_cast<U>(Value);
+			}
+		}
+
 		const EglTFRuntimeAlembicPODType PODType;
 		const uint8 Extent;
 
@@ -655,6 +757,125 @@ namespace glTFRuntimeAlembic
 
 			return true;
 		}
+
+		bool GetDigest(const uint32 TrueSampleIndex, FSampleDigest& Digest) const
+		{
+			const TSharedPtr<FOgawaData> Data = Group->GetData(TrueSampleIndex * 2);
+			if (!Data || Data->Num() < 16)
+			{
+				return false;
+			}
+
+			FMemory::Memcpy(&Digest.Low, Data->Data.GetData(), sizeof(uint64));
+			FMemory::Memcpy(&Digest.High, Data->Data.GetData() + sizeof(uint64), sizeof(uint64));
+
+			return true;
+		}
+
+		// read the whole sample (Num() * Extent scalars) with a single data lookup and type dispatch
+		template<typename T>
+		bool GetValues(const uint32 TrueSampleIndex, TArray<T>& Values)
+		{
+			if (PODSize == 0)
+			{
+				return false;
+			}
+
+			Values.SetNumUninitialized(Num(TrueSampleIndex) * Extent, EAllowShrinking::No);
+
+			return GetValues(TrueSampleIndex, TArrayView<T>(Values));
+		}
+
+		// Values must hold exactly Num() * Extent scalars
+		template<typename T>
+		bool GetValues(const uint32 TrueSampleIndex, const TArrayView<T> Values)
+		{
+			if (PODSize == 0 || static_cast<uint64>(Values.Num()) != Num(TrueSampleIndex) * Extent)
+			{
+				return false;
+			}
+
+			const TSharedPtr<FOgawaData> Data = Group->GetData(TrueSampleIndex * 2);
+			if (!Data)
+			{
+				return false;
+			}
+
+			if (Values.Num() == 0)
+			{
+				return true;
+			}
+
+			// skip initial hash
+			if (16 + Values.Num() * PODSize > Data->Num())
+			{
+				return false;
+			}
+
+			const uint8* Payload = Data->Data.GetData() + 16;
+
+			switch (PODType)
+			{
+			case EglTFRuntimeAlembicPODType::Boolean:
+			case EglTFRuntimeAlembicPODType::Uint8:
+				CastArrayValues<uint8>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Float16:
+				CastArrayValues<FFloat16>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Float32:
+				CastArrayValues<float>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Float64:
+				CastArrayValues<double>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Int8:
+				CastArrayValues<int8>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Uint16:
+				CastArrayValues<uint16>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Int16:
+				CastArrayValues<int16>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Uint32:
+				CastArrayValues<uint32>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Int32:
+				CastArrayValues<int32>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Uint64:
+				CastArrayValues<uint64>(Payload, Values);
+				return true;
+			case EglTFRuntimeAlembicPODType::Int64:
+				CastArrayValues<int64>(Payload, Values);
+				return true;
+			default:
+				break;
+			}
+
+			return false;
+		}
+
+		template<typename T, typename U>
+		static void CastArrayValues(const uint8* Payload, const TArrayView<U> Values)
+		{
+			// matching types are a plain copy
+			if constexpr (std::is_same_v<T, U>)
+			{
+				FMemory::Memcpy(Values.GetData(), Payload, Values.Num() * sizeof(T));
+			}
+			else
+			{
+				for (int32 ValueIndex = 0; ValueIndex < Values.Num(); ValueIndex++)
+				{
+					// the payload is not guaranteed to be aligned
+					T Value;
+					FMemory::Memcpy(&Value, Payload + ValueIndex * sizeof(T), sizeof(T));
+					Values[ValueIndex] = static_cast<U>(Value);
+				}
+			}
+		}
 	};
 
 	struct GLTFRUNTIMEALEMBIC_API FObject : public TSharedFromThis<FObject>
@@ -724,4 +945,6 @@ namespace glTFRuntimeAlembic
 	GLTFRUNTIMEALEMBIC_API TSharedPtr<FObject> ParseArchive(const TArrayView64<uint8>& Blob);
 	GLTFRUNTIMEALEMBIC_API TMap<FString, FString> DataToMetadata(const TArrayView64<uint8>& Data);
 	GLTFRUNTIMEALEMBIC_API bool BuildMatrix(const uint32 OpsTrueSampleIndex, const TSharedRef<FScalarProperty>& Ops, const uint32 ValsTrueSampleIndex, const TSharedRef<FScalarProperty>& Vals, FMatrix& Matrix);
+	// like BuildMatrix, but translate, rotate and scale ops (in this order, the common case) are composed directly into a TRS, other stacks are decomposed from their matrix
+	GLTFRUNTIMEALEMBIC_API bool BuildTransform(const uint32 OpsTrueSampleIndex, const TSharedRef<FScalarProperty>& Ops, const uint32 ValsTrueSampleIndex, const TSharedRef<FScalarProperty>& Vals, FTransform& Transform);
 }
@@ -0,0 +1,58 @@
+// Copyright 2025 - Roberto De Ioris
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "glTFRuntimeABC.h"
+#include "glTFRuntimeABCMesh.h"
+
+namespace glTFRuntimeAlembic
+{
+	// strands of an AbcGeom_Curve_v2 sample in compressed sparse row form: vertices of strand S are Positions[Offsets[S] .. Offsets[S + 1]]
+	struct GLTFRUNTIMEALEMBIC_API FCurvesSample
+	{
+		uint32 NumVerticesTrueSampleIndex = 0;
+		uint32 PositionsTrueSampleIndex = 0;
+
+		TArray<int32> Offsets;
+		// Alembic space
+		TArray<FVector3f> Positions;
+
+		int32 NumStrands() const
+		{
+			return Offsets.Num() > 0 ? Offsets.Num() - 1 : 0;
+		}
+
+		int32 NumVertices(const int32 StrandIndex) const
+		{
+			return Offsets[StrandIndex + 1] - Offsets[StrandIndex];
+		}
+	};
+
+	// decode .geom/nVertices and .geom/P with a single pass each, returns false if the vertex counts do not add up to the number of positions
+	GLTFRUNTIMEALEMBIC_API bool ReadCurvesSample(const FObject& Object, const uint32 SampleIndex, FCurvesSample& Sample);
+
+	// a curves geom param expanded to Extent floats per strand (uniform and constant scopes) or per vertex (vertex and varying scopes)
+	struct GLTFRUNTIMEALEMBIC_API FCurvesAttribute
+	{
+		TArray<float> Values;
+		uint8 Extent = 0;
+		bool bPerVertex = false;
+
+		bool IsValid() const
+		{
+			return Extent > 0;
+		}
+
+		// the Extent floats of a strand or of a vertex
+		const float* GetValue(const int32 Index) const
+		{
+			return Values.GetData() + Index * Extent;
+		}
+	};
+
+	// read (with a single pass) and expand a geom param of a curves sample (like .geom/width or .geom/.arbGeomParams/groom_color), indices of indexed geom params are resolved
+	// when the scope is missing it is guessed from the number of elements, varying values of cubic curves (one per segment end) are blended along the vertices of their strand
+	// returns false if the number of elements does not match the scope
+	GLTFRUNTIMEALEMBIC_API bool ReadCurvesAttribute(const FObject& Object, const FString& PropertyPath, const uint32 SampleIndex, const FCurvesSample& Sample, FCurvesAttribute& Attribute);
+}
@@ -0,0 +1,145 @@
+// Copyright 2025 - Roberto De Ioris
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+#include "glTFRuntimeParser.h"
+#include "glTFRuntimeABCCurves.h"
+
+namespace glTFRuntimeAlembic
+{
+	/**
+	 * In-memory storage of the frames of a mesh with constant topology.
+	 * Frames are grouped in blocks: positions are quantized to 16 bits against the block bounds, normals and tangents are octahedron encoded (16 bits per component),
+	 * the first frame of a block is stored as is (keyframe) and the others as 8 or 16 bit deltas against the previous frame.
+	 */
+	struct GLTFRUNTIMEALEMBIC_API FCompressedFrameStore
+	{
+		FCompressedFrameStore() = default;
+		FCompressedFrameStore(const FCompressedFrameStore& Other) = delete;
+		FCompressedFrameStore& operator=(const FCompressedFrameStore& Other) = delete;
+
+		// encode a keyframe followed by delta frames, the first added frame defines the layout (primitives, indices, UVs and materials) and all the others must match it
+		bool AddBlock(const TArrayView<const FglTFRuntimeMeshLOD> BlockFrames);
+
+		// thread safe, decodes from the keyframe of the block
+		bool DecodeFrame(const int32 FrameIndex, FglTFRuntimeMeshLOD& RuntimeLOD) const;
+
+		int32 NumFrames() const
+		{
+			return Frames.Num();
+		}
+
+		int64 GetCompressedSize() const;
+
+		// size of positions, normals and tangents of every frame at full precision
+		int64 GetUncompressedSize() const;
+
+		float GetCompressionRatio() const;
+
+		// MB of full precision attributes produced per second of decoding
+		double GetDecodeThroughput() const;
+
+	protected:
+		struct FBlock
+		{
+			int32 FirstFrameIndex = 0;
+			FVector Min = FVector::ZeroVector;
+			FVector Scale = FVector::ZeroVector;
+		};
+
+		struct FFrame
+		{
+			int32 BlockIndex = 0;
+			bool bKeyframe = false;
+			// keyframes: raw quantized values, delta frames: chunks of a width byte (1 or 2) followed by the deltas
+			TArray<uint8> Data;
+		};
+
+		bool MatchesLayout(const FglTFRuntimeMeshLOD& RuntimeLOD) const;
+		void Quantize(const FglTFRuntimeMeshLOD& RuntimeLOD, const FBlock& Block, TArray<uint16>& Values) const;
+
+		// the first frame without positions, normals and tangents
+		FglTFRuntimeMeshLOD Layout;
+		TArray<int32> PrimitivesFirstVertex;
+		int32 NumVertices = 0;
+		bool bHasLayout = false;
+
+		TArray<FBlock> Blocks;
+		TArray<FFrame> Frames;
+
+		mutable std::atomic<int64> DecodeCycles = 0;
+		mutable std::atomic<int64> DecodedBytes = 0;
+	};
+
+	/**
+	 * In-memory storage of the animated positions of curves with constant topology (the vertex counts of the strands never change).
+	 * Uses the same blocks of FCompressedFrameStore: positions quantized to 16 bits against the block bounds, a keyframe followed by 8 or 16 bit deltas.
+	 */
+	struct GLTFRUNTIMEALEMBIC_API FCompressedCurvesStore
+	{
+		FCompressedCurvesStore() = default;
+		FCompressedCurvesStore(const FCompressedCurvesStore& Other) = delete;
+		FCompressedCurvesStore& operator=(const FCompressedCurvesStore& Other) = delete;
+
+		// decode every sample of an AbcGeom_Curve_v2 object (the samples of a block in parallel) and compress them, returns false if the topology changes between samples
+		bool Build(const FObject& Object, const int32 KeyframeInterval);
+
+		// encode a keyframe followed by delta frames, the first added sample defines the strands and all the others must match them
+		bool AddBlock(const TArrayView<const FCurvesSample> BlockSamples);
+
+		// thread safe, decodes the positions (Alembic space) from the keyframe of the block
+		bool DecodeFrame(const int32 FrameIndex, TArray<FVector3f>& Positions) const;
+
+		int32 NumFrames() const
+		{
+			return Frames.Num();
+		}
+
+		// vertex offsets of the strands shared by all the frames (see FCurvesSample)
+		const TArray<int32>& GetOffsets() const
+		{
+			return Offsets;
+		}
+
+		int64 GetCompressedSize() const;
+
+		// size of the positions of every frame at full precision
+		int64 GetUncompressedSize() const;
+
+		float GetCompressionRatio() const;
+
+		// MB of full precision positions produced per second of decoding
+		double GetDecodeThroughput() const;
+
+	protected:
+		struct FBlock
+		{
+			int32 FirstFrameIndex = 0;
+			FVector3f Min = FVector3f::ZeroVector;
+			FVector3f Scale = FVector3f::ZeroVector;
+		};
+
+		struct FFrame
+		{
+			int32 BlockIndex = 0;
+			bool bKeyframe = false;
+			TArray<uint8> Data;
+		};
+
+		TArray<int32> Offsets;
+		int32 NumVertices = 0;
+		bool bHasLayout = false;
+
+		TArray<FBlock> Blocks;
+		TArray<FFrame> Frames;
+
+		mutable std::atomic<int64> DecodeCycles = 0;
+		mutable std::atomic<int64> DecodedBytes = 0;
+	};
+
+	// octahedral mapping of a unit vector to two 16 bit values
+	GLTFRUNTIMEALEMBIC_API void EncodeOctahedron(const FVector& Vector, uint16& U, uint16& V);
+	GLTFRUNTIMEALEMBIC_API FVector DecodeOctahedron(const uint16 U, const uint16 V);
+}
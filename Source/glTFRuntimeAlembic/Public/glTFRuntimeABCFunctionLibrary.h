@@ -6,8 +6,27 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "glTFRuntimeAsset.h"
 #include "glTFRuntimeABC.h"
+#include "glTFRuntimeABCMesh.h"
+#include "glTFRuntimeABCFrameStore.h"
+#include "glTFRuntimeAlembicConfig.h"
 #include "glTFRuntimeABCFunctionLibrary.generated.h"
 
+struct FglTFRuntimeGeometryCacheFrame;
+struct FHairDescription;
+
+namespace glTFRuntimeAlembic
+{
+	// a subtree collapsed by UglTFRuntimeABCFunctionLibrary::LoadRigidSkeletalMeshFromAlembicObject, before any UObject is created
+	struct FRigidSkeletalMesh
+	{
+		// the skeleton and the merged, rigidly skinned, primitives
+		FglTFRuntimeMeshLOD RuntimeLOD;
+		// keys of the animated bones, empty when the animation is not baked or nothing moves
+		TMap<FString, FRawAnimSequenceTrack> AnimTracks;
+		float AnimDuration = 0;
+	};
+}
+
 /**
  *
  */
@@ -17,16 +36,108 @@ class GLTFRUNTIMEALEMBIC_API UglTFRuntimeABCFunctionLibrary : public UBlueprintF
 	GENERATED_BODY()
 
 public:
-	UFUNCTION(BlueprintCallable, meta = (AdvancedDisplay = "MaterialsConfig", AutoCreateRefTerm = "StaticMeshMaterialsConfig"), Category = "glTFRuntime|Alembic")
-	static bool LoadAlembicObjectAsRuntimeLOD(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const int32 SampleIndex, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig);
+	UFUNCTION(BlueprintCallable, meta = (AdvancedDisplay = "MaterialsConfig", AutoCreateRefTerm = "StaticMeshMaterialsConfig,AlembicConfig"), Category = "glTFRuntime|Alembic")
+	static bool LoadAlembicObjectAsRuntimeLOD(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const int32 SampleIndex, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig = FglTFRuntimeAlembicConfig());
+
+	// the mesh at Time (seconds), between two samples positions are interpolated (see glTFRuntimeAlembic::InterpolatePositions)
+	UFUNCTION(BlueprintCallable, meta = (AdvancedDisplay = "MaterialsConfig", AutoCreateRefTerm = "StaticMeshMaterialsConfig,AlembicConfig"), Category = "glTFRuntime|Alembic")
+	static bool LoadAlembicObjectAsRuntimeLODAtTime(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const float Time, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, const float FramesPerSecond = 24);
+
+	// LOD 0 followed by the simplified LODs described by AlembicConfig.LODs
+	UFUNCTION(BlueprintCallable, meta = (AdvancedDisplay = "MaterialsConfig", AutoCreateRefTerm = "StaticMeshMaterialsConfig,AlembicConfig"), Category = "glTFRuntime|Alembic")
+	static bool LoadAlembicObjectAsRuntimeLODs(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const int32 SampleIndex, TArray<FglTFRuntimeMeshLOD>& RuntimeLODs, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig);
+
+	// bake the samples selected by AlembicConfig (FirstSampleIndex, LastSampleIndex and SampleStride) into a geometry cache
+	UFUNCTION(BlueprintCallable, meta = (AdvancedDisplay = "MaterialsConfig", AutoCreateRefTerm = "StaticMeshMaterialsConfig,AlembicConfig"), Category = "glTFRuntime|Alembic")
+	static class UGeometryCache* LoadAlembicObjectAsGeometryCache(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig);
+
+	// merge the polymeshes of a subtree (at SampleIndex, pre-transformed relatively to the object) by material, with a ChunkSize > 0 polymeshes are grouped in cells of that size (by their bounds center) and every cell gets its own runtime LOD
+	UFUNCTION(BlueprintCallable, meta = (AdvancedDisplay = "MaterialsConfig", AutoCreateRefTerm = "StaticMeshMaterialsConfig,AlembicConfig"), Category = "glTFRuntime|Alembic")
+	static bool LoadAlembicObjectAsMergedRuntimeLODs(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const int32 SampleIndex, TArray<FglTFRuntimeMeshLOD>& ChunksRuntimeLODs, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, const float ChunkSize = 0);
+
+	// collapse an xform subtree into a skeletal mesh: one bone per xform, the polymeshes (at AlembicConfig.FirstSampleIndex) rigidly skinned to their closest xform and merged by material
+	// the xform samples selected by AlembicConfig (FirstSampleIndex, LastSampleIndex and SampleStride) are baked into AnimSequence (nullptr when nothing is animated)
+	UFUNCTION(BlueprintCallable, meta = (AutoCreateRefTerm = "SkeletalMeshConfig,AlembicConfig"), Category = "glTFRuntime|Alembic")
+	static class USkeletalMesh* LoadAlembicObjectAsSkeletalMesh(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, class UAnimSequence*& AnimSequence, const float FramesPerSecond = 24);
 
+	// strands of sample 0 with their widths (.geom/width, per vertex or per strand), root UVs (groom_root_uv or .geom/uv), colors (groom_color or Cd) and roughness (groom_roughness)
 	UFUNCTION(BlueprintCallable, meta = (AdvancedDisplay = "MaterialsConfig", AutoCreateRefTerm = "StaticMeshMaterialsConfig,SkeletalMeshMaterialsConfig"), Category = "glTFRuntime|Alembic")
 	static class UGroomAsset* LoadGroomFromAlembicObject(UglTFRuntimeAsset* Asset, const FString& ObjectPath);
 
+	// open an animated AbcGeom_Curve_v2 object into a groom cache component, which compresses every sample in memory and rebuilds its groom from them while playing
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime|Alembic")
+	static bool LoadAlembicObjectIntoGroomCacheComponent(UglTFRuntimeAsset* Asset, const FString& ObjectPath, class UglTFRuntimeAlembicGroomCacheComponent* GroomCacheComponent);
+
 	UFUNCTION(BlueprintCallable, meta = (AdvancedDisplay = "MaterialsConfig", AutoCreateRefTerm = "StaticMeshMaterialsConfig,SkeletalMeshMaterialsConfig"), Category = "glTFRuntime|Alembic")
 	static bool LoadAlembicObjectIntoSplineComponent(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const int32 SampleIndex, class USplineComponent* SplineComponent);
 
+	UFUNCTION(BlueprintCallable, meta = (Category = "glTFRuntime|Alembic"))
+	static bool GetAlembicObjectVertexCacheMetrics(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const int32 SampleIndex, FglTFRuntimeAlembicVertexCacheMetrics& Metrics);
+
 	UFUNCTION(BlueprintCallable, meta = (Category = "glTFRuntime|Alembic"))
 	static bool GetAlembicObjectPropertiesNames(UglTFRuntimeAsset* Asset, const FString& ObjectPath, const FString& CompoundPropertyPath, TArray<FString>& PropertiesNames);
 
+	// native variant working on an already parsed object, TopologyCache (optional) allows reusing triangulation and adjacency between samples
+	// when SimplifiedLODs is not null it receives one LOD for each AlembicConfig.LODs entry
+	// a SampleAlpha > 0 moves the positions towards the next sample (SampleDuration is the time in seconds between two samples)
+	static bool LoadRuntimeLODFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, const int32 SampleIndex, FglTFRuntimeMeshLOD& RuntimeLOD, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, glTFRuntimeAlembic::FMeshTopologyCache* TopologyCache = nullptr, TArray<FglTFRuntimeMeshLOD>* SimplifiedLODs = nullptr, const float SampleAlpha = 0, const float SampleDuration = 1.0f / 24);
+
+	// native variant of LoadAlembicObjectAsGeometryCache working on an already parsed object
+	static class UGeometryCache* LoadGeometryCacheFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig);
+
+	// the (decimated) frames baked by LoadGeometryCacheFromAlembicObject, no UObject is created so it can run on any thread
+	static bool LoadGeometryCacheFramesFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, TArray<FglTFRuntimeGeometryCacheFrame>& Frames, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig);
+
+	// game thread half of LoadGeometryCacheFromAlembicObject
+	static class UGeometryCache* LoadGeometryCacheFromFrames(const TArray<FglTFRuntimeGeometryCacheFrame>& Frames);
+
+	// the strands (and their attributes) of LoadGroomFromAlembicObject, no UObject is created so it can run on any thread
+	static bool LoadHairDescriptionFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, FHairDescription& HairDescription);
+
+	// game thread half of LoadGroomFromAlembicObject (bEnableSimulation is disabled for grooms driven by a groom cache)
+	static class UGroomAsset* LoadGroomFromHairDescription(FHairDescription&& HairDescription, const bool bEnableSimulation = true);
+
+	// move the vertices of a hair description filled by LoadHairDescriptionFromAlembicObject to Positions (Alembic space, one per vertex, in parallel), every other attribute is kept
+	static bool UpdateHairDescriptionPositions(UglTFRuntimeAsset* Asset, FHairDescription& HairDescription, const TArray<FVector3f>& Positions);
+
+	// every sample of a polymesh decoded (a block of KeyframeInterval samples at a time, in parallel) and compressed in memory, nullptr if the layout changes between samples
+	static TSharedPtr<glTFRuntimeAlembic::FCompressedFrameStore> LoadCompressedFrameStoreFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, const int32 KeyframeInterval, glTFRuntimeAlembic::FMeshTopologyCache* TopologyCache = nullptr);
+
+	// every sample of an AbcGeom_Curve_v2 object compressed in memory, its decoded frames are applied with UpdateHairDescriptionPositions (nullptr if the strands change between samples)
+	static TSharedPtr<glTFRuntimeAlembic::FCompressedCurvesStore> LoadCompressedCurvesStoreFromAlembicObject(const glTFRuntimeAlembic::FObject& Object, const int32 KeyframeInterval);
+
+	// the strands positions of every frame of a curves store (applied to HairDescription, the first sample) added to a groom cache processor, BlockSize frames at a time in parallel
+	// no UObject is created so it can run on any thread
+	static bool LoadGroomCacheFramesFromCurvesStore(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FCompressedCurvesStore& CurvesStore, const FHairDescription& HairDescription, const int32 BlockSize, struct FGroomCacheProcessor& Processor);
+
+	// game thread half of LoadGroomCacheFramesFromCurvesStore: a strands groom cache of NumFrames frames played at FramesPerSecond
+	static class UGroomCache* LoadGroomCacheFromProcessor(struct FGroomCacheProcessor& Processor, const int32 NumFrames, const float FramesPerSecond);
+
+	// native variant of LoadAlembicObjectAsMergedRuntimeLODs working on an already parsed object
+	static bool LoadMergedRuntimeLODsFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, const int32 SampleIndex, TArray<FglTFRuntimeMeshLOD>& ChunksRuntimeLODs, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, const float ChunkSize = 0);
+
+	// native variant of LoadAlembicObjectAsSkeletalMesh working on an already parsed object (the animation is not baked when AnimSequence is null)
+	static class USkeletalMesh* LoadSkeletalMeshFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, class UAnimSequence** AnimSequence = nullptr, const float FramesPerSecond = 24);
+
+	// skeleton, merged primitives and (with bBakeAnimation) animation keys of LoadSkeletalMeshFromAlembicObject, no UObject is created so it can run on any thread
+	static bool LoadRigidSkeletalMeshFromAlembicObject(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FObject& Object, const FglTFRuntimeMaterialsConfig& SkeletalMeshMaterialsConfig, const FglTFRuntimeAlembicConfig& AlembicConfig, glTFRuntimeAlembic::FRigidSkeletalMesh& RigidSkeletalMesh, const bool bBakeAnimation, const float FramesPerSecond = 24);
+
+	// game thread half of LoadSkeletalMeshFromAlembicObject (AnimSequence stays null without animation keys)
+	static class USkeletalMesh* LoadSkeletalMeshFromRigidSkeletalMesh(UglTFRuntimeAsset* Asset, const glTFRuntimeAlembic::FRigidSkeletalMesh& RigidSkeletalMesh, const FglTFRuntimeSkeletalMeshConfig& SkeletalMeshConfig, class UAnimSequence** AnimSequence = nullptr);
+
+	// apply Transform to the positions, normals and tangents of every primitive
+	static void TransformRuntimeLOD(FglTFRuntimeMeshLOD& RuntimeLOD, const FTransform& Transform);
+
+	// append the primitives with the same material and vertex layout to the first one of them (fewer sections and draw calls)
+	static void MergeRuntimeLODPrimitives(FglTFRuntimeMeshLOD& RuntimeLOD);
+
+	// gather the vertices of every section from the (LOD 0) Primitive into a new primitive
+	static void AddSectionsPrimitives(FglTFRuntimeMeshLOD& RuntimeLOD, const TArray<glTFRuntimeAlembic::FMeshSection>& Sections, const FglTFRuntimePrimitive& Primitive, const FglTFRuntimeMaterialsConfig& StaticMeshMaterialsConfig);
+
+	// true if linearly interpolating From and To (same primitives and indices) by Alpha reproduces every position of RuntimeLOD within MaxError
+	static bool IsRuntimeLODInterpolationWithinError(const FglTFRuntimeMeshLOD& From, const FglTFRuntimeMeshLOD& To, const FglTFRuntimeMeshLOD& RuntimeLOD, const float Alpha, const float MaxError);
+
+	// MikkTSpace tangents for every primitive (in parallel), reusing the cached ones of LODIndex when positions and normals did not change
+	static void GenerateMikkTSpaceTangents(FglTFRuntimeMeshLOD& RuntimeLOD, const uint32 PositionsTrueSampleIndex, const uint32 NormalsTrueSampleIndex, glTFRuntimeAlembic::FMeshTopologyCache* TopologyCache = nullptr, const int32 LODIndex = 0);
+
 };
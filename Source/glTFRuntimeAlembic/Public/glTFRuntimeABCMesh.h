@@ -0,0 +1,335 @@
+// Copyright 2025 - Roberto De Ioris
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "glTFRuntimeABC.h"
+#include "glTFRuntimeAlembicConfig.h"
+
+namespace glTFRuntimeAlembic
+{
+	// vertex -> triangles adjacency in compressed sparse row form: triangles of vertex V are Triangles[Offsets[V] .. Offsets[V + 1]]
+	struct GLTFRUNTIMEALEMBIC_API FVertexTriangleAdjacency
+	{
+		TArray<uint32> Offsets;
+		TArray<uint32> Triangles;
+
+		bool Build(const TArrayView<const uint32> Indices, const int32 NumVertices);
+
+		int32 NumVertices() const
+		{
+			return Offsets.Num() > 0 ? Offsets.Num() - 1 : 0;
+		}
+
+		TArrayView<const uint32> GetTriangles(const int32 VertexIndex) const
+		{
+			return TArrayView<const uint32>(Triangles.GetData() + Offsets[VertexIndex], Offsets[VertexIndex + 1] - Offsets[VertexIndex]);
+		}
+	};
+
+	enum class EGeomScope : uint8
+	{
+		Constant,
+		Uniform,
+		Varying,
+		Vertex,
+		FaceVarying,
+		Unknown
+	};
+
+	// a (optionally indexed) geom param sample (like .geom/uv), values are stored flat (Extent floats per element)
+	struct GLTFRUNTIMEALEMBIC_API FGeomParamSample
+	{
+		TArray<float> Values;
+		TArray<uint32> Indices;
+		EGeomScope Scope = EGeomScope::Unknown;
+		uint8 Extent = 0;
+		uint32 ValuesTrueSampleIndex = 0;
+		uint32 IndicesTrueSampleIndex = 0;
+
+		uint32 NumElements() const
+		{
+			return Extent > 0 ? Values.Num() / Extent : 0;
+		}
+
+		// map a mesh corner to the element holding its value
+		uint32 GetElementIndex(const uint32 FaceIndex, const uint32 FaceVertexIndex, const uint32 PositionIndex) const
+		{
+			uint32 Index = FaceVertexIndex;
+			if (Scope == EGeomScope::Vertex || Scope == EGeomScope::Varying)
+			{
+				Index = PositionIndex;
+			}
+			else if (Scope == EGeomScope::Uniform)
+			{
+				Index = FaceIndex;
+			}
+			else if (Scope == EGeomScope::Constant)
+			{
+				Index = 0;
+			}
+
+			if (Indices.Num() > 0)
+			{
+				return Indices.IsValidIndex(Index) ? Indices[Index] : 0;
+			}
+
+			return Index;
+		}
+	};
+
+	GLTFRUNTIMEALEMBIC_API EGeomScope GetGeomScope(const TMap<FString, FString>& Metadata);
+
+	// resolve both the plain array and the indexed compound (.vals + .indices) forms of a geom param
+	GLTFRUNTIMEALEMBIC_API bool ReadGeomParam(const FObject& Object, const FString& PropertyPath, const uint32 SampleIndex, FGeomParamSample& Sample);
+
+	// AbcGeom_FaceSet_v1 child of a polymesh
+	struct GLTFRUNTIMEALEMBIC_API FFaceSet
+	{
+		FString Name;
+		uint32 TrueSampleIndex = 0;
+		TArray<int32> Faces;
+	};
+
+	GLTFRUNTIMEALEMBIC_API bool ReadFaceSets(const FObject& Object, const uint32 SampleIndex, TArray<FFaceSet>& FaceSets);
+
+	// digest of everything a polymesh sample is built from (positions, topology, normals, UVs and face sets), objects with the same digest generate the same mesh
+	GLTFRUNTIMEALEMBIC_API bool GetMeshDigest(const FObject& Object, const uint32 SampleIndex, FSampleDigest& Digest);
+
+	// true sample indices of the properties a polymesh sample is built from, two samples with the same topology key differ only in positions and normals
+	struct GLTFRUNTIMEALEMBIC_API FMeshSampleVersion
+	{
+		// .faceIndices, .faceCounts, UVs and face sets
+		uint64 TopologyKey = MAX_uint64;
+		uint32 PositionsTrueSampleIndex = MAX_uint32;
+		// MAX_uint32 when normals are generated from the positions
+		uint32 NormalsTrueSampleIndex = MAX_uint32;
+
+		bool IsValid() const
+		{
+			return TopologyKey != MAX_uint64;
+		}
+
+		bool HasSameTopology(const FMeshSampleVersion& Other) const
+		{
+			return IsValid() && TopologyKey == Other.TopologyKey;
+		}
+
+		bool HasSamePositions(const FMeshSampleVersion& Other) const
+		{
+			return HasSameTopology(Other) && PositionsTrueSampleIndex == Other.PositionsTrueSampleIndex;
+		}
+
+		bool HasSameNormals(const FMeshSampleVersion& Other) const
+		{
+			if (NormalsTrueSampleIndex == MAX_uint32 || Other.NormalsTrueSampleIndex == MAX_uint32)
+			{
+				return NormalsTrueSampleIndex == Other.NormalsTrueSampleIndex && HasSamePositions(Other);
+			}
+			return HasSameTopology(Other) && NormalsTrueSampleIndex == Other.NormalsTrueSampleIndex;
+		}
+	};
+
+	// only the property headers are read, no sample data is loaded
+	GLTFRUNTIMEALEMBIC_API bool GetMeshSampleVersion(const FObject& Object, const uint32 SampleIndex, FMeshSampleVersion& Version);
+
+	// where glTFRuntimeAlembic::BuildDynamicMesh placed the vertices of each primitive, allows updating positions and normals without rebuilding the mesh
+	struct FDynamicMeshVertexLayout
+	{
+		TArray<int32> PrimitivesFirstVertexID;
+		TArray<int32> PrimitivesFirstNormalID;
+		TArray<int32> PrimitivesNumVertices;
+		// copies of the vertices of non manifold triangles (copy, original)
+		TArray<TPair<int32, int32>> SplitVertices;
+		int32 NumVertices = 0;
+		int32 NumNormals = 0;
+	};
+
+	// Positions = From + (To - From) * Alpha (SIMD, Positions can alias From)
+	GLTFRUNTIMEALEMBIC_API void LerpPositions(const TArrayView<const FVector> From, const TArrayView<const FVector> To, const float Alpha, const TArrayView<FVector> Positions);
+
+	// Positions += Velocities * DeltaTime (SIMD)
+	GLTFRUNTIMEALEMBIC_API void IntegrateVelocities(const TArrayView<FVector> Positions, const TArrayView<const FVector> Velocities, const float DeltaTime);
+
+	// true if blending From and To by Alpha reproduces every position within MaxError (SIMD, chunks of vertices checked in parallel until the first vertex out of bounds)
+	GLTFRUNTIMEALEMBIC_API bool IsInterpolationWithinError(const TArrayView<const FVector> From, const TArrayView<const FVector> To, const TArrayView<const FVector> Positions, const float Alpha, const double MaxError);
+
+	// move the (untransformed) positions of SampleIndex by Alpha (0-1) towards the next sample: .geom/.velocities are integrated over Alpha * SampleDuration seconds
+	// when available, otherwise positions are blended with the next sample if the topology does not change; returns false (leaving Positions untouched) when neither is possible
+	GLTFRUNTIMEALEMBIC_API bool InterpolatePositions(const FObject& Object, const uint32 SampleIndex, const float Alpha, const float SampleDuration, TArray<FVector>& Positions);
+
+	// a contiguous range of the (face set sorted) triangles, with its own compact vertex list
+	struct GLTFRUNTIMEALEMBIC_API FMeshSection
+	{
+		FString Name;
+		// -1 for faces not belonging to any face set
+		int32 FaceSetIndex = INDEX_NONE;
+		// section vertex -> topology vertex
+		TArray<uint32> Vertices;
+		// triangle corners in section vertex space
+		TArray<uint32> Indices;
+	};
+
+	// triangulated polymesh topology, can be reused by every sample sharing the same .faceIndices/.faceCounts
+	struct GLTFRUNTIMEALEMBIC_API FMeshTopology
+	{
+		uint32 FaceIndicesTrueSampleIndex = 0;
+		uint32 FaceCountsTrueSampleIndex = 0;
+		int32 NumPositions = 0;
+
+		// position index of each triangle corner
+		TArray<uint32> Indices;
+		// face-varying index (.faceIndices slot) of each triangle corner
+		TArray<uint32> FaceVertexIndices;
+		// source polygon of each triangle
+		TArray<uint32> TriangleFaces;
+
+		FVertexTriangleAdjacency Adjacency;
+
+		// when UVs are available, positions are split on UV seams: each vertex maps to a position and a UV element
+		uint64 UVsKey = MAX_uint64;
+		TArray<uint32> VertexPositions;
+		TArray<uint32> VertexUVs;
+		TArray<uint32> VertexIndices;
+
+		// when face sets are available triangles are grouped by face set into sections
+		uint64 FaceSetsKey = MAX_uint64;
+		TArray<FMeshSection> Sections;
+
+		bool bVertexCacheOptimized = false;
+		FglTFRuntimeAlembicVertexCacheMetrics VertexCacheMetrics;
+
+		// simplified LODs (one array of sections per LOD, parallel to Sections), vertices are a subset of the LOD 0 ones
+		uint32 LODsKey = 0;
+		TArray<TArray<FMeshSection>> LODSections;
+
+		bool HasSplitVertices() const
+		{
+			return VertexPositions.Num() > 0;
+		}
+
+		int32 NumVertices() const
+		{
+			return HasSplitVertices() ? VertexPositions.Num() : NumPositions;
+		}
+
+		const TArray<uint32>& GetVertexIndices() const
+		{
+			return HasSplitVertices() ? VertexIndices : Indices;
+		}
+
+		uint32 GetVertexPosition(const uint32 VertexIndex) const
+		{
+			return HasSplitVertices() ? VertexPositions[VertexIndex] : VertexIndex;
+		}
+
+		bool Matches(const uint32 InFaceIndicesTrueSampleIndex, const uint32 InFaceCountsTrueSampleIndex, const int32 InNumPositions, const uint64 InUVsKey, const uint64 InFaceSetsKey, const bool bInVertexCacheOptimized, const uint32 InLODsKey) const
+		{
+			return FaceIndicesTrueSampleIndex == InFaceIndicesTrueSampleIndex && FaceCountsTrueSampleIndex == InFaceCountsTrueSampleIndex && NumPositions == InNumPositions && UVsKey == InUVsKey && FaceSetsKey == InFaceSetsKey && bVertexCacheOptimized == bInVertexCacheOptimized && LODsKey == InLODsKey;
+		}
+
+		static uint64 GetUVsKey(const FGeomParamSample* UVs)
+		{
+			if (!UVs)
+			{
+				return MAX_uint64;
+			}
+			return (static_cast<uint64>(UVs->IndicesTrueSampleIndex) << 32) | (UVs->Indices.Num() > 0 ? 0 : UVs->ValuesTrueSampleIndex);
+		}
+
+		static uint64 GetFaceSetsKey(const TArray<FFaceSet>* FaceSets)
+		{
+			if (!FaceSets || FaceSets->Num() == 0)
+			{
+				return MAX_uint64;
+			}
+
+			uint64 Key = FaceSets->Num();
+			for (const FFaceSet& FaceSet : *FaceSets)
+			{
+				Key = (Key * 31) + FaceSet.TrueSampleIndex;
+			}
+			return Key;
+		}
+
+		static uint32 GetLODsKey(const TArrayView<const float> TriangleRatios)
+		{
+			uint32 Key = TriangleRatios.Num();
+			for (const float TriangleRatio : TriangleRatios)
+			{
+				Key = HashCombine(Key, GetTypeHash(TriangleRatio));
+			}
+			return Key;
+		}
+	};
+
+	// MikkTSpace tangents (one array per primitive) of the last processed sample of a LOD, valid until positions, normals or topology change
+	struct FMeshTangentsCache
+	{
+		uint32 PositionsTrueSampleIndex = MAX_uint32;
+		uint32 NormalsTrueSampleIndex = MAX_uint32;
+		TArray<TArray<FVector4>> Tangents;
+	};
+
+	struct GLTFRUNTIMEALEMBIC_API FMeshTopologyCache
+	{
+		TSharedPtr<const FMeshTopology> Topology;
+
+		// LOD 0 followed by the simplified LODs
+		TArray<FMeshTangentsCache> LODsTangents;
+
+		FCriticalSection Lock;
+	};
+
+	GLTFRUNTIMEALEMBIC_API TSharedPtr<FMeshTopology> BuildMeshTopology(const TSharedRef<FArrayProperty>& FaceIndicesProperty, const uint32 FaceIndicesTrueSampleIndex, const TSharedRef<FArrayProperty>& FaceCountsProperty, const uint32 FaceCountsTrueSampleIndex, const TArrayView<const FVector> Positions, const FGeomParamSample* UVs = nullptr, const TArray<FFaceSet>* FaceSets = nullptr);
+
+	// sort triangles by face set and build the sections (faces not covered by any face set end in a trailing section)
+	GLTFRUNTIMEALEMBIC_API void BuildMeshSections(FMeshTopology& Topology, const TArray<FFaceSet>& FaceSets);
+
+	struct FVertexCacheStats
+	{
+		int32 NumTriangles = 0;
+		int32 NumVertices = 0;
+		int32 NumTransforms = 0;
+
+		float GetACMR() const
+		{
+			return NumTriangles > 0 ? static_cast<float>(NumTransforms) / NumTriangles : 0;
+		}
+
+		float GetATVR() const
+		{
+			return NumVertices > 0 ? static_cast<float>(NumTransforms) / NumVertices : 0;
+		}
+	};
+
+	// simulate a FIFO post-transform cache (CacheSize entries) over an index buffer
+	GLTFRUNTIMEALEMBIC_API FVertexCacheStats SimulateVertexCache(const TArrayView<const uint32> Indices, const int32 NumVertices, const int32 CacheSize = 16);
+
+	// Forsyth "linear speed vertex cache optimisation" triangle reordering
+	GLTFRUNTIMEALEMBIC_API bool OptimizeVertexCache(TArray<uint32>& Indices, const int32 NumVertices);
+
+	// renumber vertices in first-use order, Vertices (new vertex -> payload index) is permuted accordingly
+	GLTFRUNTIMEALEMBIC_API void OptimizeVertexFetch(TArray<uint32>& Indices, TArray<uint32>& Vertices);
+
+	// optimize every section (a single section covering the whole mesh is created when there are no face sets)
+	GLTFRUNTIMEALEMBIC_API void OptimizeMeshTopology(FMeshTopology& Topology);
+
+	// quadric error half-edge collapses until TargetNumTriangles is reached (or no valid collapse is left), surviving vertices never move
+	// so the result is an index buffer over the original vertices; LockedVertices (optional) are never collapsed
+	GLTFRUNTIMEALEMBIC_API bool SimplifyMesh(const TArrayView<const FVector> Positions, const TArrayView<const uint32> Indices, const TArrayView<const bool> LockedVertices, const int32 TargetNumTriangles, TArray<uint32>& OutIndices);
+
+	// build Topology.LODSections (one LOD for each ratio) simplifying every section in parallel, vertices on UV seams and section borders are locked
+	GLTFRUNTIMEALEMBIC_API bool BuildMeshLODs(FMeshTopology& Topology, const TArrayView<const FVector> Positions, const TArrayView<const float> TriangleRatios);
+
+	GLTFRUNTIMEALEMBIC_API FVector ComputeArbitraryTangent(const FVector& Normal);
+
+	// gather-only smooth normals generation over positions (runs in parallel over vertices), tangents are derived in the same pass
+	GLTFRUNTIMEALEMBIC_API void ComputeSmoothNormals(const FMeshTopology& Topology, const TArrayView<const FVector> Positions, const EglTFRuntimeAlembicNormalsWeighting Weighting, TArray<FVector>& Normals, TArray<FVector4>& Tangents);
+
+	// average face-varying normals into per-vertex normals using the same adjacency
+	GLTFRUNTIMEALEMBIC_API void ComputeFaceVaryingNormals(const FMeshTopology& Topology, const TArrayView<const FVector> FaceVaryingNormals, TArray<FVector>& Normals, TArray<FVector4>& Tangents);
+
+	// MikkTSpace tangents (W is the bitangent sign) for an indexed triangle list
+	GLTFRUNTIMEALEMBIC_API bool ComputeMikkTSpaceTangents(const TArrayView<const uint32> Indices, const TArrayView<const FVector> Positions, const TArrayView<const FVector> Normals, const TArrayView<const FVector2D> UVs, TArray<FVector4>& Tangents);
+}
@@ -0,0 +1,157 @@
+// Copyright 2025 - Roberto De Ioris
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "glTFRuntimeABC.h"
+
+namespace glTFRuntimeAlembic
+{
+	// translation, rotation and scale of every sample of an xform (in Alembic space), a channel not changing over time holds a single key
+	struct GLTFRUNTIMEALEMBIC_API FXformTrack
+	{
+		TArray<FVector3f> Translations;
+		TArray<FQuat4f> Rotations;
+		TArray<FVector3f> Scales;
+		int32 NumSamples = 0;
+
+		bool IsAnimated() const
+		{
+			return Translations.Num() > 1 || Rotations.Num() > 1 || Scales.Num() > 1;
+		}
+
+		// the transform of SampleIndex (clamped), blended by Alpha (0-1) towards the next sample
+		FTransform GetTransform(const int32 SampleIndex, const float Alpha = 0) const;
+
+		// reduce the channels whose keys are all equal (within Tolerance) to a single key
+		void CollapseConstantChannels(const float Tolerance = UE_KINDA_SMALL_NUMBER);
+	};
+
+	// evaluate .xform/.ops and .xform/.vals for every sample (samples sharing the same true indices are built once)
+	GLTFRUNTIMEALEMBIC_API bool BakeXformTrack(const FObject& Object, FXformTrack& Track);
+
+	// bake (in parallel) every object of the hierarchy with .xform/.ops and .xform/.vals
+	GLTFRUNTIMEALEMBIC_API void BakeXformTracks(const FObject& Root, TMap<const FObject*, FXformTrack>& Tracks);
+
+	// resolved visibility of every sample of an object: hidden ancestors hide their descendants, deferred values inherit the parent one
+	struct GLTFRUNTIMEALEMBIC_API FVisibilityTrack
+	{
+		// one bit per sample (a single bit when the visibility never changes), empty for objects always visible
+		TBitArray<> Samples;
+
+		int32 NumSamples() const
+		{
+			return Samples.Num();
+		}
+
+		bool IsAnimated() const
+		{
+			return Samples.Num() > 1;
+		}
+
+		// SampleIndex is clamped
+		bool IsVisible(const int32 SampleIndex) const
+		{
+			return Samples.Num() == 0 || Samples[FMath::Clamp(SampleIndex, 0, Samples.Num() - 1)];
+		}
+
+		bool IsAlwaysHidden() const;
+
+		// any visible sample between the two (clamped) indices, in any order
+		bool IsVisibleInRange(const int32 FirstSampleIndex, const int32 LastSampleIndex) const;
+	};
+
+	// combine the "visible" property of Object (-1 deferred, 0 hidden, 1 visible) with the track of its parent (nullptr when always visible), returns false if the object is always visible
+	GLTFRUNTIMEALEMBIC_API bool BakeVisibilityTrack(const FObject& Object, const FVisibilityTrack* ParentTrack, FVisibilityTrack& Track);
+
+	// tracks of every object of the hierarchy hidden (by itself or by an ancestor) for at least one sample
+	GLTFRUNTIMEALEMBIC_API void BakeVisibilityTracks(const FObject& Root, TMap<const FObject*, FVisibilityTrack>& Tracks);
+
+	/**
+	 * Flat, breadth first, view of a hierarchy (parents always precede their children) for evaluating the world matrices of every object at once.
+	 * Local matrices are built in parallel and then composed level by level, objects with .xform/.inherits false ignore the matrices of their parents.
+	 */
+	struct GLTFRUNTIMEALEMBIC_API FXformHierarchy
+	{
+		void Build(const FObject& Root);
+
+		int32 Num() const
+		{
+			return Objects.Num();
+		}
+
+		// INDEX_NONE if the object is not part of the hierarchy
+		int32 GetObjectIndex(const FObject& Object) const;
+
+		// the highest number of samples of the xforms
+		int32 GetNumSamples() const;
+
+		// world matrices (in Alembic space) of every object at SampleIndex (clamped for every property), blended by Alpha (0-1) towards the next sample
+		// objects without an xform get the matrix of their parent, returns false if any xform fails (it is evaluated as identity)
+		bool EvaluateWorldMatrices(const int32 SampleIndex, TArray<FMatrix>& WorldMatrices, const float Alpha = 0) const;
+
+		bool EvaluateWorldMatrices(const float Time, const float FramesPerSecond, TArray<FMatrix>& WorldMatrices) const;
+
+		TArray<const FObject*> Objects;
+		// INDEX_NONE for the root
+		TArray<int32> ParentIndices;
+		// index of the first object of every level, followed by the number of objects
+		TArray<int32> LevelOffsets;
+
+	protected:
+		struct FXformProperties
+		{
+			TSharedPtr<FScalarProperty> Ops;
+			TSharedPtr<FScalarProperty> Vals;
+			TSharedPtr<FScalarProperty> Inherits;
+		};
+
+		bool GetLocalMatrix(const int32 ObjectIndex, const int32 SampleIndex, const float Alpha, FMatrix& Matrix, bool& bInherits) const;
+
+		TArray<FXformProperties> Xforms;
+		TMap<const FObject*, int32> ObjectIndices;
+	};
+
+	// one bone per xform of a subtree (the root object is always bone 0), with the polymeshes rigidly bound to the bone of their closest xform
+	// xforms with .xform/.inherits false (at their first sample) are parented to the root bone, their transform is moved to its space by GetBoneTransform
+	struct GLTFRUNTIMEALEMBIC_API FRigidSkeleton
+	{
+		struct FBone
+		{
+			const FObject* Object = nullptr;
+			// INDEX_NONE for the root
+			int32 ParentIndex = INDEX_NONE;
+			// object names made unique
+			FString Name;
+			bool bInherits = true;
+		};
+
+		struct FRigidMesh
+		{
+			const FObject* Object = nullptr;
+			int32 BoneIndex = 0;
+		};
+
+		// parents always precede their children, returns false if the subtree has no polymeshes
+		bool Build(const FObject& Root);
+
+		// local transform (in Alembic space) of a bone at SampleIndex from the tracks baked for every bone, non inheriting bones are relative to the root bone (or to the parent of the root for the root itself)
+		FTransform GetBoneTransform(const TArray<FXformTrack>& Tracks, const int32 BoneIndex, const int32 SampleIndex) const;
+
+		// true if GetBoneTransform changes between samples
+		bool IsBoneAnimated(const TArray<FXformTrack>& Tracks, const int32 BoneIndex) const;
+
+		TArray<FBone> Bones;
+		TArray<FRigidMesh> Meshes;
+
+		// objects above the root (the nearest first) with their .xform/.inherits, only baked when a bone does not inherit
+		TArray<FXformTrack> AncestorsTracks;
+		TArray<bool> AncestorsInherits;
+
+	protected:
+		// world matrix of the parent of the root
+		FMatrix GetAncestorsMatrix(const int32 SampleIndex) const;
+
+		bool AreAncestorsAnimated() const;
+	};
+}
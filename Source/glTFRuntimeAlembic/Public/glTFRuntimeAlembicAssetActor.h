@@ -6,8 +6,19 @@
 #include "GameFramework/Actor.h"
 #include "glTFRuntimeAsset.h"
 #include "glTFRuntimeABC.h"
+#include "glTFRuntimeABCXform.h"
+#include "glTFRuntimeABCFrameStore.h"
+#include "glTFRuntimeAlembicConfig.h"
 #include "glTFRuntimeAlembicAssetActor.generated.h"
 
+struct FglTFRuntimeGeometryCacheFrame;
+struct FHairDescription;
+
+namespace glTFRuntimeAlembic
+{
+	struct FRigidSkeletalMesh;
+}
+
 
 UCLASS()
 class GLTFRUNTIMEALEMBIC_API AglTFRuntimeAlembicAssetActor : public AActor
@@ -24,8 +35,141 @@ protected:
 
 	void ProcessObject(USceneComponent* Component, TSharedRef<glTFRuntimeAlembic::FObject> Object);
 
+	// create (and process or enqueue) the components of the children of Object, Offset is the transform of the flattened xforms between Component and them
+	void AddChildComponents(USceneComponent* Component, const TSharedRef<glTFRuntimeAlembic::FObject>& Object, const FTransform& Offset);
+
+	// static (and inheriting) xforms that are the identity or have a single child do not need a component, their transform is returned to be folded into their children
+	bool CanFlattenXform(const glTFRuntimeAlembic::FObject& Object, FTransform& Transform) const;
+
+	UStaticMesh* LoadStaticMesh(const TSharedRef<glTFRuntimeAlembic::FObject>& Object);
+
+	// LOD 0 followed by the simplified LODs, does not touch the actor so it can run on any thread
+	static bool LoadMeshLODs(UglTFRuntimeAsset* InAsset, const glTFRuntimeAlembic::FObject& Object, const int32 InSampleIndex, const FglTFRuntimeMaterialsConfig& MaterialsConfig, const FglTFRuntimeAlembicConfig& InAlembicConfig, TArray<FglTFRuntimeMeshLOD>& LODs);
+
+	static bool IsLeafPolyMesh(const glTFRuntimeAlembic::FObject& Object);
+
+	void LoadAsync();
+
+	// everything decoded by the background task, the game thread only creates the components and the assets
+	struct FAsyncLoadResult
+	{
+		TSharedPtr<glTFRuntimeAlembic::FObject> RootObject;
+		TMap<const glTFRuntimeAlembic::FObject*, TArray<FglTFRuntimeMeshLOD>> MeshesLODs;
+		TMap<glTFRuntimeAlembic::FSampleDigest, const glTFRuntimeAlembic::FObject*> MeshesRepresentatives;
+		TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FSampleDigest> MeshDigests;
+		TMap<glTFRuntimeAlembic::FSampleDigest, int32> MeshDigestsCounters;
+		TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FXformTrack> XformTracks;
+		TMap<const glTFRuntimeAlembic::FObject*, TArray<FglTFRuntimeMeshLOD>> MergedMeshesLODs;
+		TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FVisibilityTrack> VisibilityTracks;
+		TMap<const glTFRuntimeAlembic::FObject*, TSharedPtr<TArray<FglTFRuntimeGeometryCacheFrame>>> GeometryCachesFrames;
+		TMap<const glTFRuntimeAlembic::FObject*, TSharedPtr<FHairDescription>> HairDescriptions;
+		TMap<const glTFRuntimeAlembic::FObject*, TSharedPtr<const glTFRuntimeAlembic::FCompressedCurvesStore>> CurvesStores;
+		TMap<const glTFRuntimeAlembic::FObject*, TSharedPtr<const glTFRuntimeAlembic::FCompressedFrameStore>> FrameStores;
+		TMap<const glTFRuntimeAlembic::FObject*, TSharedPtr<glTFRuntimeAlembic::FRigidSkeletalMesh>> RigidSkeletalMeshes;
+	};
+
+	void OnAsyncMeshesLoaded(FAsyncLoadResult&& Result);
+
+	void FinishLoading();
+
+	// one static mesh component (attached to Component) for every chunk of the merged polymeshes of the subtree
+	void AddMergedStaticMeshes(USceneComponent* Component, const glTFRuntimeAlembic::FObject& Object);
+
+	// count polymeshes generating the same mesh (only leaf polymeshes, always visible and without animated xforms above them, can become instances)
+	// static as it runs on the async task too, with bSkipAnimated (playback mode) the animated polymeshes are streamed
+	static void CollectMeshDigests(const glTFRuntimeAlembic::FObject& Object, const TSet<FString>& SkeletalMeshPaths, const TSet<FString>& MergedPaths, const TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FVisibilityTrack>& InVisibilityTracks, const TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FXformTrack>& InXformTracks, const bool bSkipAnimated, const int32 InSampleIndex, TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FSampleDigest>& OutMeshDigests, TMap<glTFRuntimeAlembic::FSampleDigest, int32>& OutMeshDigestsCounters, const bool bAnimatedAncestor = false);
+
+	// returns false if the polymesh is not shared with other objects and needs its own component
+	bool AddMeshInstance(USceneComponent* ParentComponent, const TSharedRef<glTFRuntimeAlembic::FObject>& Object, const FTransform& Offset);
+
+	TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FSampleDigest> MeshDigests;
+	TMap<glTFRuntimeAlembic::FSampleDigest, int32> MeshDigestsCounters;
+	TMap<glTFRuntimeAlembic::FSampleDigest, class UHierarchicalInstancedStaticMeshComponent*> InstancedMeshComponents;
+
+	// async mode: meshes built by the background task and the objects still waiting for their components
+	bool bAsyncLoading = false;
+	TSharedPtr<glTFRuntimeAlembic::FObject> AsyncRootObject;
+	TMap<const glTFRuntimeAlembic::FObject*, TArray<FglTFRuntimeMeshLOD>> AsyncMeshesLODs;
+	TMap<glTFRuntimeAlembic::FSampleDigest, const glTFRuntimeAlembic::FObject*> AsyncMeshesRepresentatives;
+	// chunks of the merged subtrees
+	TMap<const glTFRuntimeAlembic::FObject*, TArray<FglTFRuntimeMeshLOD>> AsyncMergedMeshesLODs;
+	// baked geometry caches and grooms, turned into assets by ProcessObject
+	TMap<const glTFRuntimeAlembic::FObject*, TSharedPtr<TArray<FglTFRuntimeGeometryCacheFrame>>> AsyncGeometryCachesFrames;
+	TMap<const glTFRuntimeAlembic::FObject*, TSharedPtr<FHairDescription>> AsyncHairDescriptions;
+	// compressed samples of the animated grooms, opened into their groom cache components
+	TMap<const glTFRuntimeAlembic::FObject*, TSharedPtr<const glTFRuntimeAlembic::FCompressedCurvesStore>> AsyncCurvesStores;
+	// compressed samples of the streamed polymeshes (with bCompressStreamedSamples), opened into their streaming components
+	TMap<const glTFRuntimeAlembic::FObject*, TSharedPtr<const glTFRuntimeAlembic::FCompressedFrameStore>> AsyncFrameStores;
+	// skeletons, merged meshes and animation keys of SkeletalMeshObjectPaths, turned into assets by ProcessObject
+	TMap<const glTFRuntimeAlembic::FObject*, TSharedPtr<glTFRuntimeAlembic::FRigidSkeletalMesh>> AsyncRigidSkeletalMeshes;
+	TArray<TPair<USceneComponent*, TSharedRef<glTFRuntimeAlembic::FObject>>> AsyncPendingObjects;
+	int32 AsyncPendingObjectIndex = 0;
+
 	int32 TrueSampleIndex = 0;
 
+	static bool IsAnimatedPolyMesh(const glTFRuntimeAlembic::FObject& Object);
+
+	static bool IsAnimatedCurves(const glTFRuntimeAlembic::FObject& Object);
+
+	// objects hidden over all the samples the actor can show (every sample when playing, only InSampleIndex otherwise) get no component and are never decoded
+	static bool IsHiddenObject(const TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FVisibilityTrack>& InVisibilityTracks, const glTFRuntimeAlembic::FObject& Object, const bool bAllSamples, const int32 InSampleIndex);
+
+	// apply the .xform ops of InSampleIndex (followed by the Offset of the flattened parents), returns false if the sample is missing
+	bool UpdateXform(USceneComponent* Component, const glTFRuntimeAlembic::FObject& Object, const int32 InSampleIndex, const FTransform& Offset);
+
+	void UpdateAnimation();
+
+	// playback mode: xforms are baked once (before creating the components) and sampled when the playback time changes, meshes are driven through their streaming components
+	TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FXformTrack> XformTracks;
+	struct FAnimatedXform
+	{
+		USceneComponent* Component = nullptr;
+		glTFRuntimeAlembic::FXformTrack Track;
+		// flattened parents
+		FTransform Offset;
+	};
+	TArray<FAnimatedXform> AnimatedXforms;
+
+	// components whose flattened parents transform is applied after their own
+	TMap<USceneComponent*, FTransform> FlattenedOffsets;
+
+	// objects hidden for at least one sample, baked before creating the components
+	TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FVisibilityTrack> VisibilityTracks;
+	struct FAnimatedVisibility
+	{
+		USceneComponent* Component = nullptr;
+		glTFRuntimeAlembic::FVisibilityTrack Track;
+	};
+	TArray<FAnimatedVisibility> AnimatedVisibilities;
+
+	// without bPlayAnimation, the first geometry cache (baked or streamed) gives the sample of the animated visibilities
+	USceneComponent* GeometryCacheClock = nullptr;
+	void UpdateGeometryCacheVisibilities();
+
+	struct FAnimatedMesh
+	{
+		class UglTFRuntimeAlembicStreamingMeshComponent* Component = nullptr;
+		// empty when always visible, hidden meshes are not decoded
+		glTFRuntimeAlembic::FVisibilityTrack Visibility;
+	};
+	TArray<FAnimatedMesh> AnimatedMeshes;
+
+	// animated curves, played by runtime groom caches
+	TArray<class UglTFRuntimeAlembicGroomCacheComponent*> AnimatedGrooms;
+
+	// skeletal meshes animations are positioned from the actor time, their first key is at FirstSampleIndex
+	struct FAnimatedSkeletalMesh
+	{
+		class USkeletalMeshComponent* Component = nullptr;
+		int32 FirstSampleIndex = 0;
+		float Duration = 0;
+	};
+	TArray<FAnimatedSkeletalMesh> AnimatedSkeletalMeshes;
+	int32 NumAnimationSamples = 0;
+	int32 AnimationSampleIndex = INDEX_NONE;
+	float AnimationSampleAlpha = 0;
+	bool bAnimationPlaying = false;
+
 public:	
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
@@ -36,6 +180,9 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
 	FglTFRuntimeStaticMeshConfig StaticMeshConfig;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	FglTFRuntimeAlembicConfig AlembicConfig;
+
 	UFUNCTION(BlueprintNativeEvent, Category = "glTFRuntime|Alembic", meta = (DisplayName = "On StaticMeshComponent Created"))
 	void ReceiveOnStaticMeshComponentCreated(UStaticMeshComponent* StaticMeshComponent);
 
@@ -45,9 +192,88 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
 	bool bUseGeometryCache = false;
 
+	// objects whose subtree is collapsed into a single skeletal mesh component (one bone per xform, rigid polymeshes merged by material), animated xforms are baked into an animation played in playback mode
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	TArray<FString> SkeletalMeshObjectPaths;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	FglTFRuntimeSkeletalMeshConfig SkeletalMeshConfig;
+
+	// do not create components for static xforms that are the identity or wrap a single child, their transform is folded into the children components (the flattened objects tags are lost)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	bool bFlattenStaticXforms = false;
+
+	// objects (xforms, "/" for the whole archive) whose polymeshes are merged by material into a few static meshes, pre-transformed at SampleIndex (animation below them is not played)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	TArray<FString> MergedStaticMeshObjectPaths;
+
+	// merged polymeshes are split in cells of this size, so that the resulting meshes can still be culled (0 for a single mesh per subtree)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	float MergedStaticMeshChunkSize = 0;
+
+	// with bUseGeometryCache, play polymeshes through streaming dynamic meshes (decoding a small window of samples on demand) instead of baking every frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	bool bStreamGeometryCache = false;
+
+	// keep the samples of streamed polymeshes in compressed memory (quantized positions, octahedral normals, delta frames) instead of decoding them from the archive, with bAsyncLoad they are compressed by the background task
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	bool bCompressStreamedSamples = false;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
 	int32 SampleIndex = 0;
 
+	// polymeshes with identical samples (and materials) share a single static mesh rendered as instances
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	bool bInstanceIdenticalMeshes = false;
+
+	// parse the archive and decode the meshes (skeletal ones with their animation keys), the geometry cache frames and the groom strands on background tasks, components and assets are then created in Tick (at most AsyncTimeSlice seconds per frame)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	bool bAsyncLoad = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	float AsyncTimeSlice = 0.002f;
+
+	// play animated xforms, polymeshes (streamed, without baking) and curves (from compressed memory) starting from PlaybackTime, instead of showing only SampleIndex
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	bool bPlayAnimation = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	float PlayRate = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	bool bLooping = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	float FramesPerSecond = 24;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	float PlaybackTime = 0;
+
+	// in playback mode blend xforms and meshes between the samples around PlaybackTime, so low rate caches play smoothly at any rate
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ExposeOnSpawn = true), Category = "glTFRuntime|Alembic")
+	bool bInterpolateSamples = false;
+
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime|Alembic")
+	void Play();
+
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime|Alembic")
+	void Pause();
+
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime|Alembic")
+	void Seek(const float Time);
+
+	UFUNCTION(BlueprintPure, Category = "glTFRuntime|Alembic")
+	bool IsPlaying() const
+	{
+		return bAnimationPlaying;
+	}
+
+	UFUNCTION(BlueprintPure, Category = "glTFRuntime|Alembic")
+	float GetDuration() const
+	{
+		return FramesPerSecond > 0 ? NumAnimationSamples / FramesPerSecond : 0;
+	}
+
 private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"), Category = "glTFRuntime|Alembic")
 	USceneComponent* AssetRoot;
@@ -0,0 +1,115 @@
+// Copyright 2025 - Roberto De Ioris
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "glTFRuntimeAlembicConfig.generated.h"
+
+UENUM(BlueprintType)
+enum class EglTFRuntimeAlembicNormalsWeighting : uint8
+{
+	// every face normal counts the same
+	Unweighted,
+	Area,
+	Angle
+};
+
+USTRUCT(BlueprintType)
+struct FglTFRuntimeAlembicLODConfig
+{
+	GENERATED_BODY()
+
+	// fraction of the LOD 0 triangles to keep (when <= 0 it is derived from ScreenSize)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	float TriangleRatio = 0.5f;
+
+	// screen size below which this LOD is rendered (0 to keep the StaticMeshConfig/engine defaults)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	float ScreenSize = 0;
+
+	float GetTriangleRatio() const
+	{
+		if (TriangleRatio > 0)
+		{
+			return FMath::Min(TriangleRatio, 1.0f);
+		}
+
+		// the projected area (and so the number of visible triangles) scales with the square of the screen size
+		if (ScreenSize > 0)
+		{
+			return FMath::Clamp(ScreenSize * ScreenSize, 0.01f, 1.0f);
+		}
+
+		return 0.5f;
+	}
+};
+
+USTRUCT(BlueprintType)
+struct FglTFRuntimeAlembicConfig
+{
+	GENERATED_BODY()
+
+	// how face normals are weighted when generating smooth normals (used only when .geom/N is missing)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	EglTFRuntimeAlembicNormalsWeighting NormalsWeighting = EglTFRuntimeAlembicNormalsWeighting::Unweighted;
+
+	// generate MikkTSpace tangents from .geom/uv (otherwise an arbitrary perpendicular to the normal is used)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	bool bGenerateMikkTSpaceTangents = false;
+
+	// reorder triangles for the post-transform vertex cache and vertices for fetch locality (computed once per topology)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	bool bOptimizeVertexCache = false;
+
+	// additional simplified LODs (quadric error edge collapses, computed once per topology)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	TArray<FglTFRuntimeAlembicLODConfig> LODs;
+
+	// first sample baked into geometry caches
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	int32 FirstSampleIndex = 0;
+
+	// last sample (included) baked into geometry caches, -1 for the last available one
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	int32 LastSampleIndex = -1;
+
+	// bake one sample every SampleStride (the skipped ones are never decoded)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	int32 SampleStride = 1;
+
+	// when baking geometry caches, drop the frames whose positions match the last kept frame within this distance, the cache holds the kept frame in their place (0 keeps every frame)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	float FrameDecimationMaxError = 0;
+
+	// maximum number of consecutive dropped frames
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	int32 FrameDecimationMaxSpan = 64;
+
+	// geometry cache frames decoded concurrently while baking (0 for the number of worker threads, 1 to decode one frame after the other)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	int32 MaxFramesInFlight = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FglTFRuntimeAlembicVertexCacheMetrics
+{
+	GENERATED_BODY()
+
+	// average cache miss ratio (transformed vertices per triangle) of the Alembic face order
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime|Alembic")
+	float ACMRBefore = 0;
+
+	// average transform to vertex ratio of the Alembic face order
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime|Alembic")
+	float ATVRBefore = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime|Alembic")
+	float ACMRAfter = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime|Alembic")
+	float ATVRAfter = 0;
+
+	// true if every section has less than 65536 vertices (and can be rendered with 16 bit indices)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "glTFRuntime|Alembic")
+	bool bFits16BitIndices = false;
+};
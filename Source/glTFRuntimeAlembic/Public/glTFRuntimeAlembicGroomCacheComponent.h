@@ -0,0 +1,99 @@
+// Copyright 2025 - Roberto De Ioris
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GroomComponent.h"
+#include "GroomCache.h"
+#include "Tasks/Task.h"
+#include "glTFRuntimeAsset.h"
+#include "glTFRuntimeABC.h"
+#include "glTFRuntimeABCFrameStore.h"
+#include "glTFRuntimeAlembicGroomCacheComponent.generated.h"
+
+struct FHairDescription;
+
+/**
+ * Plays an animated AbcGeom_Curve_v2 object: the groom is built once from the first sample, every sample is compressed in memory when opening it and turned (on a worker thread) into a groom cache moving its strands.
+ * Widths, root UVs, colors and roughness are the ones of the first sample, the groom is not simulated.
+ */
+UCLASS(ClassGroup = (glTFRuntime), meta = (BlueprintSpawnableComponent))
+class GLTFRUNTIMEALEMBIC_API UglTFRuntimeAlembicGroomCacheComponent : public UGroomComponent
+{
+	GENERATED_BODY()
+
+public:
+	UglTFRuntimeAlembicGroomCacheComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+	virtual void BeginDestroy() override;
+
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime|Alembic")
+	bool OpenAlembicObject(UglTFRuntimeAsset* InAsset, const FString& ObjectPath);
+
+	// native variant sharing an already parsed archive
+	bool OpenAlembicObject(UglTFRuntimeAsset* InAsset, const TSharedRef<const glTFRuntimeAlembic::FObject>& InObject);
+
+	// native variant taking the strands of the first sample (see UglTFRuntimeABCFunctionLibrary::LoadHairDescriptionFromAlembicObject) and the compressed samples already decoded (e.g. on a worker thread)
+	bool OpenCurvesStore(UglTFRuntimeAsset* InAsset, const TSharedRef<const glTFRuntimeAlembic::FCompressedCurvesStore>& InCurvesStore, const TSharedRef<const FHairDescription>& InHairDescription);
+
+	UFUNCTION(BlueprintPure, Category = "glTFRuntime|Alembic")
+	int32 GetNumSamples() const
+	{
+		return NumSamples;
+	}
+
+	// show SampleIndex once the groom cache is built (returns false meanwhile, the first sample stays visible)
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime|Alembic")
+	bool SetSampleIndex(const int32 InSampleIndex);
+
+	UFUNCTION(BlueprintPure, Category = "glTFRuntime|Alembic")
+	int32 GetDisplayedSampleIndex() const
+	{
+		return DisplayedSampleIndex;
+	}
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	bool bPlaying = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	float PlayRate = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	bool bLooping = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	float FramesPerSecond = 24;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	float PlaybackTime = 0;
+
+	// frames per compressed block (one keyframe followed by deltas)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	int32 CompressedKeyframeInterval = 8;
+
+protected:
+	void WaitForBuild();
+
+	// game thread half of a build: assign the groom cache of the built frames
+	void FinishBuild();
+
+	void ShowSample(const int32 SampleIndex);
+
+	// referenced by the build task
+	UPROPERTY()
+	UglTFRuntimeAsset* Asset = nullptr;
+
+	UE::Tasks::FTask BuildTask;
+	bool bBuilding = false;
+	// written by the build task, nullptr if a frame could not be built
+	TSharedPtr<FGroomCacheProcessor> BuiltProcessor;
+	bool bGroomCacheReady = false;
+
+	int32 NumSamples = 0;
+	// FramesPerSecond when the object was opened, the time of every sample in the groom cache
+	float GroomCacheFramesPerSecond = 24;
+	int32 WantedSampleIndex = 0;
+	int32 DisplayedSampleIndex = INDEX_NONE;
+};
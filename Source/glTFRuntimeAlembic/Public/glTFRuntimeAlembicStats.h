@@ -0,0 +1,22 @@
+// Copyright 2025 - Roberto De Ioris
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("glTFRuntimeAlembic"), STATGROUP_glTFRuntimeAlembic, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("MikkTSpace Tangents"), STAT_glTFRuntimeAlembic_MikkTSpaceTangents, STATGROUP_glTFRuntimeAlembic, GLTFRUNTIMEALEMBIC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("MikkTSpace Tangents Cache Hits"), STAT_glTFRuntimeAlembic_MikkTSpaceTangentsCacheHits, STATGROUP_glTFRuntimeAlembic, GLTFRUNTIMEALEMBIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Vertex Cache Optimization"), STAT_glTFRuntimeAlembic_VertexCacheOptimization, STATGROUP_glTFRuntimeAlembic, GLTFRUNTIMEALEMBIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Mesh Simplification"), STAT_glTFRuntimeAlembic_MeshSimplification, STATGROUP_glTFRuntimeAlembic, GLTFRUNTIMEALEMBIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Geometry Cache Bake"), STAT_glTFRuntimeAlembic_GeometryCacheBake, STATGROUP_glTFRuntimeAlembic, GLTFRUNTIMEALEMBIC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Missed Prefetches"), STAT_glTFRuntimeAlembic_MissedPrefetches, STATGROUP_glTFRuntimeAlembic, GLTFRUNTIMEALEMBIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Frame Store Decode"), STAT_glTFRuntimeAlembic_FrameStoreDecode, STATGROUP_glTFRuntimeAlembic, GLTFRUNTIMEALEMBIC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("In Place Mesh Updates"), STAT_glTFRuntimeAlembic_InPlaceMeshUpdates, STATGROUP_glTFRuntimeAlembic, GLTFRUNTIMEALEMBIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Skeletal Mesh Bake"), STAT_glTFRuntimeAlembic_SkeletalMeshBake, STATGROUP_glTFRuntimeAlembic, GLTFRUNTIMEALEMBIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Static Mesh Merge"), STAT_glTFRuntimeAlembic_StaticMeshMerge, STATGROUP_glTFRuntimeAlembic, GLTFRUNTIMEALEMBIC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Flattened Xforms"), STAT_glTFRuntimeAlembic_FlattenedXforms, STATGROUP_glTFRuntimeAlembic, GLTFRUNTIMEALEMBIC_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hidden Objects"), STAT_glTFRuntimeAlembic_HiddenObjects, STATGROUP_glTFRuntimeAlembic, GLTFRUNTIMEALEMBIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Curves Read"), STAT_glTFRuntimeAlembic_CurvesRead, STATGROUP_glTFRuntimeAlembic, GLTFRUNTIMEALEMBIC_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hair Description Fill"), STAT_glTFRuntimeAlembic_HairDescriptionFill, STATGROUP_glTFRuntimeAlembic, GLTFRUNTIMEALEMBIC_API);
@@ -0,0 +1,177 @@
+// Copyright 2025 - Roberto De Ioris
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+#include "Components/DynamicMeshComponent.h"
+#include "Tasks/Task.h"
+#include "glTFRuntimeAsset.h"
+#include "glTFRuntimeABC.h"
+#include "glTFRuntimeABCMesh.h"
+#include "glTFRuntimeABCFrameStore.h"
+#include "glTFRuntimeAlembicConfig.h"
+#include "glTFRuntimeAlembicStreamingMeshComponent.generated.h"
+
+/**
+ * Plays an animated polymesh without baking it: only a small ring buffer of upcoming samples (in the playback direction) is decoded on worker threads.
+ */
+UCLASS(ClassGroup = (glTFRuntime), meta = (BlueprintSpawnableComponent))
+class GLTFRUNTIMEALEMBIC_API UglTFRuntimeAlembicStreamingMeshComponent : public UDynamicMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+	UglTFRuntimeAlembicStreamingMeshComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+	virtual void BeginDestroy() override;
+
+	UFUNCTION(BlueprintCallable, meta = (AutoCreateRefTerm = "InMaterialsConfig,InAlembicConfig"), Category = "glTFRuntime|Alembic")
+	bool OpenAlembicObject(UglTFRuntimeAsset* InAsset, const FString& ObjectPath, const FglTFRuntimeMaterialsConfig& InMaterialsConfig, const FglTFRuntimeAlembicConfig& InAlembicConfig);
+
+	// native variant sharing an already parsed archive (the object keeps it alive)
+	bool OpenAlembicObject(UglTFRuntimeAsset* InAsset, const TSharedRef<const glTFRuntimeAlembic::FObject>& InObject, const FglTFRuntimeMaterialsConfig& InMaterialsConfig, const FglTFRuntimeAlembicConfig& InAlembicConfig);
+
+	// native variant playing from a frame store already compressed (e.g. on a worker thread, see UglTFRuntimeABCFunctionLibrary::LoadCompressedFrameStoreFromAlembicObject), whatever bCompressFrames is
+	bool OpenFrameStore(UglTFRuntimeAsset* InAsset, const TSharedRef<const glTFRuntimeAlembic::FObject>& InObject, const FglTFRuntimeMaterialsConfig& InMaterialsConfig, const FglTFRuntimeAlembicConfig& InAlembicConfig, const TSharedRef<const glTFRuntimeAlembic::FCompressedFrameStore>& InFrameStore);
+
+	UFUNCTION(BlueprintPure, Category = "glTFRuntime|Alembic")
+	int32 GetNumSamples() const;
+
+	// show SampleIndex if already decoded (returns false on a miss, the previous sample stays visible) and prefetch the samples following it
+	// with bInterpolateSamples the mesh is blended by InSampleAlpha (0-1) towards the next sample
+	UFUNCTION(BlueprintCallable, Category = "glTFRuntime|Alembic")
+	bool SetSampleIndex(const int32 InSampleIndex, const float InPlayRate = 1, const bool bInLooping = true, const float InSampleAlpha = 0);
+
+	UFUNCTION(BlueprintPure, Category = "glTFRuntime|Alembic")
+	int32 GetDisplayedSampleIndex() const
+	{
+		return DisplayedSampleIndex;
+	}
+
+	// number of samples decoded ahead (and of resident decoded samples)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	int32 PrefetchWindow = 8;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	bool bPlaying = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	float PlayRate = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	bool bLooping = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	float FramesPerSecond = 24;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	float PlaybackTime = 0;
+
+	// decode every sample once when opening the object (blocking the caller, the asset actor does it on its async load task) and keep them in a compressed frame store, playback then decodes from memory instead of the archive
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	bool bCompressFrames = false;
+
+	// frames per compressed block (one keyframe followed by deltas)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	int32 CompressedKeyframeInterval = 8;
+
+	// uncompressed/compressed size of the frame store (0 without one)
+	UFUNCTION(BlueprintPure, Category = "glTFRuntime|Alembic")
+	float GetCompressionRatio() const;
+
+	// MB/s of decoded frame store attributes (0 without one)
+	UFUNCTION(BlueprintPure, Category = "glTFRuntime|Alembic")
+	float GetDecodeThroughput() const;
+
+	// blend between the two samples around the playback time (when they share the same topology), for smooth slow motion of low rate caches
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	bool bInterpolateSamples = false;
+
+	// when a sample shares the topology of the displayed one only its positions (and normals, if they changed) are written and uploaded, the index buffer and the UVs are kept
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "glTFRuntime|Alembic")
+	bool bUpdateVerticesInPlace = true;
+
+protected:
+	enum class ESlotState : uint8
+	{
+		Free,
+		Decoding,
+		Ready,
+		// currently shown and kept as the interpolation source
+		Displayed
+	};
+
+	struct FSlot
+	{
+		int32 SampleIndex = INDEX_NONE;
+		std::atomic<ESlotState> State = ESlotState::Free;
+		bool bValid = false;
+		FglTFRuntimeMeshLOD LOD;
+		glTFRuntimeAlembic::FMeshSampleVersion Version;
+		// not built when the sample is expected to update the displayed mesh in place
+		bool bHasMesh = false;
+		UE::Geometry::FDynamicMesh3 Mesh;
+		glTFRuntimeAlembic::FDynamicMeshVertexLayout MeshLayout;
+		UE::Tasks::FTask Task;
+	};
+
+	// without InFrameStore one is built when bCompressFrames is set
+	bool Open(UglTFRuntimeAsset* InAsset, const TSharedRef<const glTFRuntimeAlembic::FObject>& InObject, const FglTFRuntimeMaterialsConfig& InMaterialsConfig, const FglTFRuntimeAlembicConfig& InAlembicConfig, const TSharedPtr<const glTFRuntimeAlembic::FCompressedFrameStore>& InFrameStore);
+
+	void ResetSlots();
+	void WaitForSlots();
+
+	bool IsSampleQueued(const int32 InSampleIndex) const;
+	void DecodeSample(FSlot& Slot, const int32 InSampleIndex);
+	void DisplaySlot(FSlot& Slot);
+	void InterpolateDisplayedSlot(const int32 NextSampleIndex, const float InSampleAlpha);
+
+	// write positions and/or normals into the displayed mesh and notify only the vertex buffers, returns false if the layout does not match
+	bool UpdateMeshVertices(const FglTFRuntimeMeshLOD& RuntimeLOD, const bool bPositions, const bool bNormals);
+
+	// blend the positions and normals of two samples straight into the displayed mesh, returns false if the layout does not match
+	bool LerpMeshVertices(const FglTFRuntimeMeshLOD& From, const FglTFRuntimeMeshLOD& To, const float Alpha);
+
+	// update in place when possible, otherwise rebuild the whole mesh
+	void ShowRuntimeLOD(const FglTFRuntimeMeshLOD& RuntimeLOD);
+
+	UPROPERTY()
+	UglTFRuntimeAsset* Asset = nullptr;
+
+	TSharedPtr<const glTFRuntimeAlembic::FObject> Object;
+	FglTFRuntimeMaterialsConfig MaterialsConfig;
+	FglTFRuntimeAlembicConfig AlembicConfig;
+	glTFRuntimeAlembic::FMeshTopologyCache TopologyCache;
+	TSharedPtr<const glTFRuntimeAlembic::FCompressedFrameStore> FrameStore;
+
+	TArray<TUniquePtr<FSlot>> Slots;
+	int32 NumSamples = 0;
+	int32 DisplayedSampleIndex = INDEX_NONE;
+	// the last sample counted as a missed prefetch, every missed sample is counted once
+	int32 MissedSampleIndex = INDEX_NONE;
+	float DisplayedSampleAlpha = 0;
+	FSlot* DisplayedSlot = nullptr;
+	glTFRuntimeAlembic::FMeshSampleVersion DisplayedVersion;
+	glTFRuntimeAlembic::FDynamicMeshVertexLayout DisplayedMeshLayout;
+};
+
+namespace glTFRuntimeAlembic
+{
+	// wrap (or clamp) PlaybackTime to the clip duration and return the sample to show at that time
+	GLTFRUNTIMEALEMBIC_API int32 GetPlaybackSampleIndex(float& PlaybackTime, const int32 NumSamples, const float FramesPerSecond, const bool bLooping);
+
+	// blend positions and normals of two LODs with the same primitives and indices, returns false if the layouts differ
+	GLTFRUNTIMEALEMBIC_API bool LerpRuntimeLODs(const FglTFRuntimeMeshLOD& From, const FglTFRuntimeMeshLOD& To, const float Alpha, FglTFRuntimeMeshLOD& RuntimeLOD);
+
+	// flatten the primitives of a runtime LOD into a dynamic mesh (one polygroup and material id per primitive)
+	GLTFRUNTIMEALEMBIC_API void BuildDynamicMesh(const FglTFRuntimeMeshLOD& RuntimeLOD, UE::Geometry::FDynamicMesh3& Mesh, FDynamicMeshVertexLayout* Layout = nullptr);
+
+	// write the positions and normals blended between two LODs with the same primitives and indices into a mesh built by BuildDynamicMesh (in parallel, without an intermediate LOD), returns false (without touching the mesh) if the layouts differ
+	GLTFRUNTIMEALEMBIC_API bool LerpDynamicMeshVertices(const FglTFRuntimeMeshLOD& From, const FglTFRuntimeMeshLOD& To, const float Alpha, const FDynamicMeshVertexLayout& Layout, UE::Geometry::FDynamicMesh3& Mesh);
+
+	// overwrite positions and/or normals of a mesh built by BuildDynamicMesh from a LOD with the same primitives and indices, returns false (without touching the mesh) if the vertex counts differ
+	GLTFRUNTIMEALEMBIC_API bool UpdateDynamicMeshVertices(const FglTFRuntimeMeshLOD& RuntimeLOD, const FDynamicMeshVertexLayout& Layout, UE::Geometry::FDynamicMesh3& Mesh, const bool bPositions, const bool bNormals);
+}
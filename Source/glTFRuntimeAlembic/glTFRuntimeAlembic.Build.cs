@@ -26,6 +26,8 @@ public class glTFRuntimeAlembic : ModuleRules
             new string[]
             {
                 "Core",
+                "GeometryCore",
+                "GeometryFramework",
                 
 				// ... add other public dependencies that you statically link with here ...
 			}
@@ -41,8 +43,8 @@ public class glTFRuntimeAlembic : ModuleRules
                 "glTFRuntimeGeometryCache",
                 "HairStrandsCore",
                 "Renderer",
-                "GeometryCore",
-                "GeometryCache"
+                "GeometryCache",
+                "MikkTSpace"
             }
             );
 
@@ -0,0 +1,293 @@
+// Copyright 2025 - Roberto De Ioris
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "glTFRuntimeAlembicTests.h"
+#include "glTFRuntimeABC.h"
+#include "glTFRuntimeABCCurves.h"
+#include "glTFRuntimeABCFrameStore.h"
+#include "Misc/AutomationTest.h"
+
+namespace glTFRuntimeAlembic
+{
+	namespace Tests
+	{
+		// in-memory curves object (.geom/nVertices and .geom/P), every sample of the two arrays is stored as a changed one
+		struct FSyntheticCurves
+		{
+			FSyntheticCurves(const TArray<int32>& NumVertices, const TArray<FVector3f>& Positions) : FSyntheticCurves(TArray<TArray<int32>>{ NumVertices }, TArray<TArray<FVector3f>>{ Positions })
+			{
+			}
+
+			FSyntheticCurves(const TArray<TArray<int32>>& NumVerticesSamples, const TArray<TArray<FVector3f>>& PositionsSamples)
+			{
+				Object = MakeShared<FObject>(nullptr, "Curves", TMap<FString, FString>{ { "schema", "AbcGeom_Curve_v2" } });
+				Object->Properties = MakeShared<FCompoundProperty>("", TMap<FString, FString>());
+
+				TArray<TArrayView<const uint8>> Samples;
+				for (const TArray<int32>& NumVertices : NumVerticesSamples)
+				{
+					Samples.Add(TArrayView<const uint8>(reinterpret_cast<const uint8*>(NumVertices.GetData()), NumVertices.Num() * sizeof(int32)));
+				}
+
+				Geom = MakeShared<FCompoundProperty>(".geom", TMap<FString, FString>());
+				Geom->Children.Add(AddArrayProperty("nVertices", EglTFRuntimeAlembicPODType::Int32, 1, Samples));
+
+				Samples.Reset();
+				for (const TArray<FVector3f>& Positions : PositionsSamples)
+				{
+					Samples.Add(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Positions.GetData()), Positions.Num() * sizeof(FVector3f)));
+				}
+				Geom->Children.Add(AddArrayProperty("P", EglTFRuntimeAlembicPODType::Float32, 3, Samples));
+
+				Object->Properties->Children.Add(Geom.ToSharedRef());
+			}
+
+			// float geom param under .geom (an empty Scope leaves the geoScope metadata out), with Indices it is stored as an indexed compound
+			void AddGeomParam(const FString& Name, const uint8 Extent, const TArray<float>& Values, const FString& Scope, const TArray<uint32>& Indices = {})
+			{
+				TMap<FString, FString> Metadata;
+				if (!Scope.IsEmpty())
+				{
+					Metadata.Add("geoScope", Scope);
+				}
+
+				if (Indices.Num() > 0)
+				{
+					TSharedRef<FCompoundProperty> Compound = MakeShared<FCompoundProperty>(Name, Metadata);
+					Compound->Children.Add(AddArrayProperty(".vals", EglTFRuntimeAlembicPODType::Float32, Extent, Values.GetData(), Values.Num() * sizeof(float)));
+					Compound->Children.Add(AddArrayProperty(".indices", EglTFRuntimeAlembicPODType::Uint32, 1, Indices.GetData(), Indices.Num() * sizeof(uint32)));
+					Geom->Children.Add(Compound);
+				}
+				else
+				{
+					Geom->Children.Add(AddArrayProperty(Name, EglTFRuntimeAlembicPODType::Float32, Extent, Values.GetData(), Values.Num() * sizeof(float), Metadata));
+				}
+			}
+
+			TSharedRef<FArrayProperty> AddArrayProperty(const FString& Name, const EglTFRuntimeAlembicPODType PODType, const uint8 Extent, const void* Values, const int64 Size, const TMap<FString, FString>& Metadata = {})
+			{
+				return AddArrayProperty(Name, PODType, Extent, { TArrayView<const uint8>(static_cast<const uint8*>(Values), Size) }, Metadata);
+			}
+
+			TSharedRef<FArrayProperty> AddArrayProperty(const FString& Name, const EglTFRuntimeAlembicPODType PODType, const uint8 Extent, const TArray<TArrayView<const uint8>>& Samples, const TMap<FString, FString>& Metadata = {})
+			{
+				TSharedRef<FOgawaGroup> Group = MakeShared<FOgawaGroup>();
+				for (const TArrayView<const uint8>& Sample : Samples)
+				{
+					// 16 bytes of hash followed by the values, the empty dims make the parser derive the number of elements from the data size
+					TArray<uint8>& Buffer = *Buffers.Add_GetRef(MakeUnique<TArray<uint8>>());
+					Buffer.AddZeroed(16);
+					Buffer.Append(Sample.GetData(), Sample.Num());
+
+					TSharedRef<FOgawaData> Data = MakeShared<FOgawaData>();
+					Data->Data = TArrayView64<uint8>(Buffer.GetData(), Buffer.Num());
+					Group->Children.Add(Data);
+					Group->Children.Add(MakeShared<FOgawaData>());
+				}
+
+				const uint32 NumSamples = Samples.Num();
+				return MakeShared<FArrayProperty>(Name, PODType, Extent, Metadata, Group, NumSamples, NumSamples > 1 ? 1 : 0, NumSamples > 1 ? NumSamples - 1 : 0, 0);
+			}
+
+			TArray<TUniquePtr<TArray<uint8>>> Buffers;
+			TSharedPtr<FObject> Object;
+			TSharedPtr<FCompoundProperty> Geom;
+		};
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Curves_BulkRead, "glTFRuntime.Alembic.UnitTests.Curves.BulkRead", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Curves_BulkRead::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeAlembic::Tests;
+
+	// a dense groom: 200k strands of 8 to 24 vertices
+	constexpr int32 NumStrands = 200000;
+	TArray<int32> NumVertices;
+	TArray<FVector3f> Positions;
+	NumVertices.Reserve(NumStrands);
+	for (int32 StrandIndex = 0; StrandIndex < NumStrands; StrandIndex++)
+	{
+		NumVertices.Add(8 + StrandIndex % 17);
+		for (int32 VertexIndex = 0; VertexIndex < NumVertices.Last(); VertexIndex++)
+		{
+			Positions.Add(FVector3f(static_cast<float>(StrandIndex % 1000), static_cast<float>(StrandIndex / 1000), VertexIndex * 0.5f));
+		}
+	}
+
+	FSyntheticCurves Curves(NumVertices, Positions);
+
+	const uint64 BulkStartCycles = FPlatformTime::Cycles64();
+	glTFRuntimeAlembic::FCurvesSample Sample;
+	TestTrue("ReadCurvesSample(Curves, 0, Sample)", glTFRuntimeAlembic::ReadCurvesSample(*Curves.Object, 0, Sample));
+	const uint64 BulkCycles = FPlatformTime::Cycles64() - BulkStartCycles;
+
+	// the previous per-element path: a data lookup for every strand count and every position
+	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> NumVerticesProperty = Curves.Object->FindArrayProperty(".geom/nVertices");
+	TSharedPtr<glTFRuntimeAlembic::FArrayProperty> PositionsProperty = Curves.Object->FindArrayProperty(".geom/P");
+	const uint64 ReferenceStartCycles = FPlatformTime::Cycles64();
+	TArray<int32> ReferenceOffsets = { 0 };
+	TArray<FVector3f> ReferencePositions;
+	for (uint64 StrandIndex = 0; StrandIndex < NumVerticesProperty->Num(0); StrandIndex++)
+	{
+		int32 StrandNumVertices = 0;
+		NumVerticesProperty->Get(0, StrandIndex, 0, StrandNumVertices);
+		for (int32 VertexIndex = 0; VertexIndex < StrandNumVertices; VertexIndex++)
+		{
+			FVector Position;
+			PositionsProperty->Get(0, ReferenceOffsets.Last() + VertexIndex, Position);
+			ReferencePositions.Add(FVector3f(Position));
+		}
+		ReferenceOffsets.Add(ReferenceOffsets.Last() + StrandNumVertices);
+	}
+	const uint64 ReferenceCycles = FPlatformTime::Cycles64() - ReferenceStartCycles;
+
+	TestEqual("Sample.NumStrands() == NumStrands", Sample.NumStrands(), NumStrands);
+	TestEqual("Sample.NumVertices(16) == 24", Sample.NumVertices(16), 24);
+	TestTrue("Sample.Offsets == ReferenceOffsets", Sample.Offsets == ReferenceOffsets);
+	TestTrue("Sample.Positions == ReferencePositions", Sample.Positions == ReferencePositions);
+
+	AddInfo(FString::Printf(TEXT("%d strands, %d vertices: per element %.2f ms, bulk %.2f ms"), NumStrands, Positions.Num(), FPlatformTime::ToMilliseconds64(ReferenceCycles), FPlatformTime::ToMilliseconds64(BulkCycles)));
+
+	// vertex counts not matching the positions
+	NumVertices[0]++;
+	FSyntheticCurves BrokenCurves(NumVertices, Positions);
+	TestFalse("ReadCurvesSample(BrokenCurves, 0, Sample)", glTFRuntimeAlembic::ReadCurvesSample(*BrokenCurves.Object, 0, Sample));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Curves_Attributes, "glTFRuntime.Alembic.UnitTests.Curves.Attributes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Curves_Attributes::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeAlembic::Tests;
+
+	// two strands of 2 and 3 vertices
+	FSyntheticCurves Curves({ 2, 3 }, { FVector3f(0.0f, 0.0f, 0.0f), FVector3f(0.0f, 0.0f, 1.0f), FVector3f(1.0f, 0.0f, 0.0f), FVector3f(1.0f, 0.0f, 1.0f), FVector3f(1.0f, 0.0f, 2.0f) });
+	Curves.AddGeomParam("width", 1, { 0.5f, 0.4f, 0.3f, 0.2f, 0.1f }, "vtx");
+	Curves.AddGeomParam("color", 3, { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f }, "uni", { 1, 0 });
+	Curves.AddGeomParam("roughness", 1, { 0.25f }, "con");
+	Curves.AddGeomParam("uv", 2, { 0.1f, 0.2f, 0.3f, 0.4f }, "");
+	Curves.AddGeomParam("broken", 1, { 1.0f, 2.0f, 3.0f }, "uni");
+
+	glTFRuntimeAlembic::FCurvesSample Sample;
+	TestTrue("ReadCurvesSample(Curves, 0, Sample)", glTFRuntimeAlembic::ReadCurvesSample(*Curves.Object, 0, Sample));
+
+	glTFRuntimeAlembic::FCurvesAttribute Widths;
+	TestTrue("ReadCurvesAttribute(Curves, \".geom/width\", 0, Sample, Widths)", glTFRuntimeAlembic::ReadCurvesAttribute(*Curves.Object, ".geom/width", 0, Sample, Widths));
+	TestTrue("Widths.bPerVertex", Widths.bPerVertex);
+	TestEqual("Widths.GetValue(3)[0] == 0.2", Widths.GetValue(3)[0], 0.2f);
+
+	glTFRuntimeAlembic::FCurvesAttribute Colors;
+	TestTrue("ReadCurvesAttribute(Curves, \".geom/color\", 0, Sample, Colors)", glTFRuntimeAlembic::ReadCurvesAttribute(*Curves.Object, ".geom/color", 0, Sample, Colors));
+	TestFalse("Colors.bPerVertex", Colors.bPerVertex);
+	TestEqual("Colors.Extent == 3", Colors.Extent, static_cast<uint8>(3));
+	TestEqual("Colors.GetValue(0)[1] == 1", Colors.GetValue(0)[1], 1.0f);
+	TestEqual("Colors.GetValue(1)[0] == 1", Colors.GetValue(1)[0], 1.0f);
+
+	// constant values are expanded to every strand
+	glTFRuntimeAlembic::FCurvesAttribute Roughness;
+	TestTrue("ReadCurvesAttribute(Curves, \".geom/roughness\", 0, Sample, Roughness)", glTFRuntimeAlembic::ReadCurvesAttribute(*Curves.Object, ".geom/roughness", 0, Sample, Roughness));
+	TestEqual("Roughness.Values.Num() == 2", Roughness.Values.Num(), 2);
+	TestEqual("Roughness.GetValue(1)[0] == 0.25", Roughness.GetValue(1)[0], 0.25f);
+
+	// no geoScope, one value per strand
+	glTFRuntimeAlembic::FCurvesAttribute RootUVs;
+	TestTrue("ReadCurvesAttribute(Curves, \".geom/uv\", 0, Sample, RootUVs)", glTFRuntimeAlembic::ReadCurvesAttribute(*Curves.Object, ".geom/uv", 0, Sample, RootUVs));
+	TestFalse("RootUVs.bPerVertex", RootUVs.bPerVertex);
+	TestEqual("RootUVs.GetValue(1)[1] == 0.4", RootUVs.GetValue(1)[1], 0.4f);
+
+	glTFRuntimeAlembic::FCurvesAttribute Broken;
+	TestFalse("ReadCurvesAttribute(Curves, \".geom/broken\", 0, Sample, Broken)", glTFRuntimeAlembic::ReadCurvesAttribute(*Curves.Object, ".geom/broken", 0, Sample, Broken));
+	TestFalse("ReadCurvesAttribute(Curves, \".geom/missing\", 0, Sample, Broken)", glTFRuntimeAlembic::ReadCurvesAttribute(*Curves.Object, ".geom/missing", 0, Sample, Broken));
+
+	// cubic strands of 4 and 5 vertices, with nVertices - 2 varying values each
+	FSyntheticCurves CubicCurves({ 4, 5 }, { FVector3f(0.0f, 0.0f, 0.0f), FVector3f(0.0f, 0.0f, 1.0f), FVector3f(0.0f, 0.0f, 2.0f), FVector3f(0.0f, 0.0f, 3.0f), FVector3f(1.0f, 0.0f, 0.0f), FVector3f(1.0f, 0.0f, 1.0f), FVector3f(1.0f, 0.0f, 2.0f), FVector3f(1.0f, 0.0f, 3.0f), FVector3f(1.0f, 0.0f, 4.0f) });
+	CubicCurves.AddGeomParam("width", 1, { 0.3f, 0.6f, 0.2f, 0.4f, 0.6f }, "var");
+
+	glTFRuntimeAlembic::FCurvesSample CubicSample;
+	TestTrue("ReadCurvesSample(CubicCurves, 0, CubicSample)", glTFRuntimeAlembic::ReadCurvesSample(*CubicCurves.Object, 0, CubicSample));
+
+	glTFRuntimeAlembic::FCurvesAttribute VaryingWidths;
+	TestTrue("ReadCurvesAttribute(CubicCurves, \".geom/width\", 0, CubicSample, VaryingWidths)", glTFRuntimeAlembic::ReadCurvesAttribute(*CubicCurves.Object, ".geom/width", 0, CubicSample, VaryingWidths));
+	TestTrue("VaryingWidths.bPerVertex", VaryingWidths.bPerVertex);
+	TestEqual("VaryingWidths.Values.Num() == 9", VaryingWidths.Values.Num(), 9);
+	// the ends of the strands get the first and last varying values, the inner vertices a blend of them
+	TestEqual("VaryingWidths.GetValue(0)[0] == 0.3", VaryingWidths.GetValue(0)[0], 0.3f);
+	TestEqual("VaryingWidths.GetValue(3)[0] == 0.6", VaryingWidths.GetValue(3)[0], 0.6f);
+	TestTrue("VaryingWidths.GetValue(1)[0] == 0.4", FMath::IsNearlyEqual(VaryingWidths.GetValue(1)[0], 0.4f, 0.0001f));
+	TestTrue("VaryingWidths.GetValue(6)[0] == 0.4", FMath::IsNearlyEqual(VaryingWidths.GetValue(6)[0], 0.4f, 0.0001f));
+	TestEqual("VaryingWidths.GetValue(8)[0] == 0.6", VaryingWidths.GetValue(8)[0], 0.6f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Curves_CompressedStore, "glTFRuntime.Alembic.UnitTests.Curves.CompressedStore", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Curves_CompressedStore::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeAlembic::Tests;
+
+	// 1000 strands of 16 vertices swaying over 20 samples
+	constexpr int32 NumStrands = 1000;
+	constexpr int32 NumStrandVertices = 16;
+	constexpr int32 NumSamples = 20;
+	TArray<int32> NumVertices;
+	NumVertices.Init(NumStrandVertices, NumStrands);
+	TArray<TArray<FVector3f>> PositionsSamples;
+	for (int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex++)
+	{
+		TArray<FVector3f>& Positions = PositionsSamples.AddDefaulted_GetRef();
+		for (int32 StrandIndex = 0; StrandIndex < NumStrands; StrandIndex++)
+		{
+			for (int32 VertexIndex = 0; VertexIndex < NumStrandVertices; VertexIndex++)
+			{
+				const float Sway = FMath::Sin(SampleIndex * 0.2f + StrandIndex * 0.01f) * VertexIndex * 0.05f;
+				Positions.Add(FVector3f(static_cast<float>(StrandIndex % 40) + Sway, static_cast<float>(StrandIndex / 40), VertexIndex * 0.5f));
+			}
+		}
+	}
+
+	TArray<TArray<int32>> NumVerticesSamples;
+	NumVerticesSamples.Init(NumVertices, NumSamples);
+	FSyntheticCurves Curves(NumVerticesSamples, PositionsSamples);
+
+	glTFRuntimeAlembic::FCompressedCurvesStore Store;
+	TestTrue("Store.Build(Curves, 8)", Store.Build(*Curves.Object, 8));
+	TestEqual("Store.NumFrames() == NumSamples", Store.NumFrames(), NumSamples);
+	TestEqual("Store.GetOffsets().Num() == NumStrands + 1", Store.GetOffsets().Num(), NumStrands + 1);
+	TestTrue("Store.GetCompressionRatio() > 2", Store.GetCompressionRatio() > 2);
+
+	// keyframes and delta frames (19 is the last frame of the third block) within the quantization error
+	for (const int32 FrameIndex : { 0, 5, 8, 19 })
+	{
+		TArray<FVector3f> Positions;
+		TestTrue(FString::Printf(TEXT("Store.DecodeFrame(%d, Positions)"), FrameIndex), Store.DecodeFrame(FrameIndex, Positions));
+		TestEqual(FString::Printf(TEXT("Positions.Num() == PositionsSamples[%d].Num()"), FrameIndex), Positions.Num(), PositionsSamples[FrameIndex].Num());
+
+		float MaxError = 0;
+		for (int32 VertexIndex = 0; VertexIndex < Positions.Num(); VertexIndex++)
+		{
+			MaxError = FMath::Max(MaxError, FVector3f::Distance(Positions[VertexIndex], PositionsSamples[FrameIndex][VertexIndex]));
+		}
+		TestTrue(FString::Printf(TEXT("MaxError (%f) < 0.001"), MaxError), MaxError < 0.001f);
+	}
+
+	TArray<FVector3f> Positions;
+	TestFalse("Store.DecodeFrame(NumSamples, Positions)", Store.DecodeFrame(NumSamples, Positions));
+
+	AddInfo(FString::Printf(TEXT("%d samples of %d vertices: %lld bytes compressed to %lld (ratio %.2f)"), NumSamples, NumStrands * NumStrandVertices, Store.GetUncompressedSize(), Store.GetCompressedSize(), Store.GetCompressionRatio()));
+
+	// the vertex counts change in the last sample
+	NumVerticesSamples.Last()[0]--;
+	NumVerticesSamples.Last()[1]++;
+	FSyntheticCurves ChangingCurves(NumVerticesSamples, PositionsSamples);
+	glTFRuntimeAlembic::FCompressedCurvesStore ChangingStore;
+	TestFalse("ChangingStore.Build(ChangingCurves, 8)", ChangingStore.Build(*ChangingCurves.Object, 8));
+
+	return true;
+}
+
+#endif
\ No newline at end of file
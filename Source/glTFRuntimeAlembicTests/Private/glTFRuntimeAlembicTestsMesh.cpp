@@ -0,0 +1,508 @@
+// Copyright 2025 - Roberto De Ioris
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "glTFRuntimeAlembicTests.h"
+#include "glTFRuntimeABC.h"
+#include "glTFRuntimeABCMesh.h"
+#include "glTFRuntimeAlembicStreamingMeshComponent.h"
+#include "glTFRuntimeABCFrameStore.h"
+#include "glTFRuntimeABCFunctionLibrary.h"
+#include "DynamicMesh/DynamicMeshAttributeSet.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Mesh_Adjacency, "glTFRuntime.Alembic.UnitTests.Mesh.Adjacency", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Mesh_Adjacency::RunTest(const FString& Parameters)
+{
+	glTFRuntimeAlembic::FVertexTriangleAdjacency Adjacency;
+
+	const TArray<uint32> Indices = { 0, 1, 2, 2, 1, 3 };
+	const TArray<uint32> BrokenIndices = { 0, 1, 4 };
+
+	TestTrue("Adjacency.Build(Indices, 4)", Adjacency.Build(Indices, 4));
+
+	TestEqual("Adjacency.NumVertices() == 4", Adjacency.NumVertices(), 4);
+	TestEqual("Adjacency.GetTriangles(0).Num() == 1", Adjacency.GetTriangles(0).Num(), 1);
+	TestEqual("Adjacency.GetTriangles(1).Num() == 2", Adjacency.GetTriangles(1).Num(), 2);
+	TestEqual("Adjacency.GetTriangles(3)[0] == 1", static_cast<int32>(Adjacency.GetTriangles(3)[0]), 1);
+
+	TestFalse("Adjacency.Build(BrokenIndices, 4)", Adjacency.Build(BrokenIndices, 4));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Mesh_BlenderDefaultTopology, "glTFRuntime.Alembic.UnitTests.Mesh.BlenderDefaultTopology", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Mesh_BlenderDefaultTopology::RunTest(const FString& Parameters)
+{
+	glTFRuntimeAlembic::Tests::FFixture Fixture("blender_default.abc");
+
+	TSharedPtr<glTFRuntimeAlembic::FObject> RootObject = glTFRuntimeAlembic::ParseArchive(Fixture.Blob);
+
+	TSharedPtr<const glTFRuntimeAlembic::FObject> Cube = RootObject->Find("/Cube/Cube");
+
+	TArray<FVector> Positions;
+	Cube->FindArrayProperty(".geom/P")->Get(0, Positions);
+
+	TSharedPtr<glTFRuntimeAlembic::FMeshTopology> Topology = glTFRuntimeAlembic::BuildMeshTopology(Cube->FindArrayProperty(".geom/.faceIndices").ToSharedRef(), 0, Cube->FindArrayProperty(".geom/.faceCounts").ToSharedRef(), 0, Positions);
+
+	TestTrue("Topology != nullptr", Topology != nullptr);
+
+	TestEqual("Topology->Indices.Num() == 36", Topology->Indices.Num(), 36);
+
+	TestEqual("Topology->Adjacency.NumVertices() == 8", Topology->Adjacency.NumVertices(), 8);
+
+	TArray<FVector> Normals;
+	TArray<FVector4> Tangents;
+	glTFRuntimeAlembic::ComputeSmoothNormals(*Topology, Positions, EglTFRuntimeAlembicNormalsWeighting::Angle, Normals, Tangents);
+
+	TestTrue("Normals[0].IsNormalized()", Normals[0].IsNormalized());
+
+	TestTrue("Normals[0] is not axis aligned", !FMath::IsNearlyEqual(FMath::Abs(Normals[0].X), 1.0));
+
+	// the default keeps the normals of the previous releases
+	TestTrue("FglTFRuntimeAlembicConfig().NormalsWeighting == Unweighted", FglTFRuntimeAlembicConfig().NormalsWeighting == EglTFRuntimeAlembicNormalsWeighting::Unweighted);
+
+	TArray<FVector> UnweightedNormals;
+	glTFRuntimeAlembic::ComputeSmoothNormals(*Topology, Positions, EglTFRuntimeAlembicNormalsWeighting::Unweighted, UnweightedNormals, Tangents);
+
+	TestTrue("UnweightedNormals[0].IsNormalized()", UnweightedNormals[0].IsNormalized());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Mesh_MikkTSpaceQuad, "glTFRuntime.Alembic.UnitTests.Mesh.MikkTSpaceQuad", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Mesh_MikkTSpaceQuad::RunTest(const FString& Parameters)
+{
+	const TArray<uint32> Indices = { 0, 1, 2, 0, 2, 3 };
+	const TArray<FVector> Positions = { FVector(0, 0, 0), FVector(1, 0, 0), FVector(1, 1, 0), FVector(0, 1, 0) };
+	const TArray<FVector> Normals = { FVector::UpVector, FVector::UpVector, FVector::UpVector, FVector::UpVector };
+	const TArray<FVector2D> UVs = { FVector2D(0, 0), FVector2D(1, 0), FVector2D(1, 1), FVector2D(0, 1) };
+
+	TArray<FVector4> Tangents;
+	TestTrue("ComputeMikkTSpaceTangents(...)", glTFRuntimeAlembic::ComputeMikkTSpaceTangents(Indices, Positions, Normals, UVs, Tangents));
+
+	TestEqual("Tangents.Num() == 4", Tangents.Num(), 4);
+
+	TestTrue("Tangents[0] follows U", FVector(Tangents[0]).Equals(FVector::ForwardVector, KINDA_SMALL_NUMBER));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Mesh_FaceSetSections, "glTFRuntime.Alembic.UnitTests.Mesh.FaceSetSections", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Mesh_FaceSetSections::RunTest(const FString& Parameters)
+{
+	glTFRuntimeAlembic::FMeshTopology Topology;
+	Topology.NumPositions = 5;
+	Topology.Indices = { 0, 1, 2, 2, 1, 3, 3, 1, 4 };
+	Topology.TriangleFaces = { 0, 1, 2 };
+
+	TArray<glTFRuntimeAlembic::FFaceSet> FaceSets;
+	FaceSets.AddDefaulted(1);
+	FaceSets[0].Name = "Metal";
+	FaceSets[0].Faces = { 1 };
+
+	glTFRuntimeAlembic::BuildMeshSections(Topology, FaceSets);
+
+	TestEqual("Topology.Sections.Num() == 2", Topology.Sections.Num(), 2);
+	TestEqual("Topology.Sections[0].Name == \"Metal\"", Topology.Sections[0].Name, "Metal");
+	TestEqual("Topology.Sections[0].Vertices.Num() == 3", Topology.Sections[0].Vertices.Num(), 3);
+	TestEqual("Topology.Sections[1].FaceSetIndex == INDEX_NONE", Topology.Sections[1].FaceSetIndex, INDEX_NONE);
+	TestEqual("Topology.Sections[1].Indices.Num() == 6", Topology.Sections[1].Indices.Num(), 6);
+	TestEqual("Topology.Sections[1].Vertices.Num() == 5", Topology.Sections[1].Vertices.Num(), 5);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Mesh_VertexCache, "glTFRuntime.Alembic.UnitTests.Mesh.VertexCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Mesh_VertexCache::RunTest(const FString& Parameters)
+{
+	// 64x64 grid with shuffled triangles
+	constexpr int32 GridSize = 64;
+	TArray<uint32> Indices;
+	for (int32 Y = 0; Y < GridSize - 1; Y++)
+	{
+		for (int32 X = 0; X < GridSize - 1; X++)
+		{
+			const uint32 Corner = Y * GridSize + X;
+			Indices.Append({ Corner, Corner + 1, Corner + GridSize, Corner + 1, Corner + GridSize + 1, Corner + GridSize });
+		}
+	}
+
+	FRandomStream RandomStream(17);
+	const int32 NumTriangles = Indices.Num() / 3;
+	for (int32 TriangleIndex = NumTriangles - 1; TriangleIndex > 0; TriangleIndex--)
+	{
+		const int32 OtherTriangleIndex = RandomStream.RandRange(0, TriangleIndex);
+		for (int32 Corner = 0; Corner < 3; Corner++)
+		{
+			Indices.Swap(TriangleIndex * 3 + Corner, OtherTriangleIndex * 3 + Corner);
+		}
+	}
+
+	const glTFRuntimeAlembic::FVertexCacheStats Before = glTFRuntimeAlembic::SimulateVertexCache(Indices, GridSize * GridSize);
+
+	TestTrue("OptimizeVertexCache(Indices)", glTFRuntimeAlembic::OptimizeVertexCache(Indices, GridSize * GridSize));
+
+	const glTFRuntimeAlembic::FVertexCacheStats After = glTFRuntimeAlembic::SimulateVertexCache(Indices, GridSize * GridSize);
+
+	TestEqual("After.NumTriangles == Before.NumTriangles", After.NumTriangles, Before.NumTriangles);
+	TestTrue("After.GetACMR() < Before.GetACMR()", After.GetACMR() < Before.GetACMR());
+	TestTrue("After.GetACMR() < 1", After.GetACMR() < 1);
+
+	TArray<uint32> Vertices;
+	for (int32 VertexIndex = 0; VertexIndex < GridSize * GridSize; VertexIndex++)
+	{
+		Vertices.Add(VertexIndex);
+	}
+
+	glTFRuntimeAlembic::OptimizeVertexFetch(Indices, Vertices);
+
+	TestEqual("Indices[0] == 0", static_cast<int32>(Indices[0]), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Mesh_Simplify, "glTFRuntime.Alembic.UnitTests.Mesh.Simplify", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Mesh_Simplify::RunTest(const FString& Parameters)
+{
+	// flat 32x32 grid
+	constexpr int32 GridSize = 32;
+	TArray<FVector> Positions;
+	TArray<uint32> Indices;
+	for (int32 Y = 0; Y < GridSize; Y++)
+	{
+		for (int32 X = 0; X < GridSize; X++)
+		{
+			Positions.Add(FVector(X, Y, 0));
+			if (X < GridSize - 1 && Y < GridSize - 1)
+			{
+				const uint32 Corner = Y * GridSize + X;
+				Indices.Append({ Corner, Corner + 1, Corner + GridSize, Corner + 1, Corner + GridSize + 1, Corner + GridSize });
+			}
+		}
+	}
+
+	const int32 NumTriangles = Indices.Num() / 3;
+
+	TArray<uint32> SimplifiedIndices;
+	TestTrue("SimplifyMesh(Positions, Indices, {}, NumTriangles / 4)", glTFRuntimeAlembic::SimplifyMesh(Positions, Indices, {}, NumTriangles / 4, SimplifiedIndices));
+
+	// the target is only a hint: the collapses rejected by the flip and link checks can stop the simplification earlier
+	const int32 NumSimplifiedTriangles = SimplifiedIndices.Num() / 3;
+	TestTrue("NumSimplifiedTriangles <= NumTriangles / 2", NumSimplifiedTriangles <= NumTriangles / 2);
+	TestTrue("NumSimplifiedTriangles >= NumTriangles / 16", NumSimplifiedTriangles >= NumTriangles / 16);
+
+	// still a manifold without degenerate triangles: every edge is shared by one or two triangles
+	TMap<TPair<uint32, uint32>, int32> EdgesTriangles;
+	for (int32 TriangleIndex = 0; TriangleIndex < NumSimplifiedTriangles; TriangleIndex++)
+	{
+		const uint32* Corners = &SimplifiedIndices[TriangleIndex * 3];
+		TestTrue("Corners are distinct", Corners[0] != Corners[1] && Corners[1] != Corners[2] && Corners[2] != Corners[0]);
+		for (int32 Corner = 0; Corner < 3; Corner++)
+		{
+			const uint32 A = Corners[Corner];
+			const uint32 B = Corners[(Corner + 1) % 3];
+			EdgesTriangles.FindOrAdd(TPair<uint32, uint32>(FMath::Min(A, B), FMath::Max(A, B)))++;
+		}
+	}
+
+	int32 MaxEdgeTriangles = 0;
+	for (const TPair<TPair<uint32, uint32>, int32>& Pair : EdgesTriangles)
+	{
+		MaxEdgeTriangles = FMath::Max(MaxEdgeTriangles, Pair.Value);
+	}
+	TestTrue("MaxEdgeTriangles <= 2", MaxEdgeTriangles <= 2);
+
+	TestTrue("SimplifiedIndices.Contains(0)", SimplifiedIndices.Contains(0));
+	TestTrue("SimplifiedIndices.Contains(GridSize * GridSize - 1)", SimplifiedIndices.Contains(GridSize * GridSize - 1));
+
+	TArray<bool> LockedVertices;
+	LockedVertices.Init(true, Positions.Num());
+
+	TestTrue("SimplifyMesh(Positions, Indices, LockedVertices, 0)", glTFRuntimeAlembic::SimplifyMesh(Positions, Indices, LockedVertices, 0, SimplifiedIndices));
+	TestEqual("SimplifiedIndices.Num() == Indices.Num()", SimplifiedIndices.Num(), Indices.Num());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Mesh_Digest, "glTFRuntime.Alembic.UnitTests.Mesh.Digest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Mesh_Digest::RunTest(const FString& Parameters)
+{
+	glTFRuntimeAlembic::Tests::FFixture Fixture("blender_default.abc");
+
+	TSharedPtr<glTFRuntimeAlembic::FObject> RootObject = glTFRuntimeAlembic::ParseArchive(Fixture.Blob);
+
+	TSharedPtr<const glTFRuntimeAlembic::FObject> Cube = RootObject->Find("/Cube/Cube");
+
+	glTFRuntimeAlembic::FSampleDigest PositionsDigest;
+	TestTrue("Cube->FindArrayProperty(\".geom/P\")->GetDigest(0, PositionsDigest)", Cube->FindArrayProperty(".geom/P")->GetDigest(0, PositionsDigest));
+	TestTrue("PositionsDigest != FSampleDigest()", PositionsDigest != glTFRuntimeAlembic::FSampleDigest());
+
+	glTFRuntimeAlembic::FSampleDigest Digest;
+	glTFRuntimeAlembic::FSampleDigest OtherDigest;
+	TestTrue("GetMeshDigest(*Cube, 0, Digest)", glTFRuntimeAlembic::GetMeshDigest(*Cube, 0, Digest));
+	TestTrue("GetMeshDigest(*Cube, 0, OtherDigest)", glTFRuntimeAlembic::GetMeshDigest(*Cube, 0, OtherDigest));
+	TestTrue("Digest == OtherDigest", Digest == OtherDigest);
+	TestTrue("Digest != PositionsDigest", Digest != PositionsDigest);
+
+	TestFalse("GetMeshDigest(*RootObject, 0, Digest)", glTFRuntimeAlembic::GetMeshDigest(*RootObject, 0, Digest));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Mesh_DynamicMesh, "glTFRuntime.Alembic.UnitTests.Mesh.DynamicMesh", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Mesh_DynamicMesh::RunTest(const FString& Parameters)
+{
+	FglTFRuntimeMeshLOD RuntimeLOD;
+	RuntimeLOD.Primitives.AddDefaulted(2);
+	for (FglTFRuntimePrimitive& Primitive : RuntimeLOD.Primitives)
+	{
+		Primitive.Positions = { FVector(0, 0, 0), FVector(1, 0, 0), FVector(1, 1, 0), FVector(0, 1, 0) };
+		Primitive.Normals = { FVector::UpVector, FVector::UpVector, FVector::UpVector, FVector::UpVector };
+		Primitive.Indices = { 0, 1, 2, 0, 2, 3 };
+	}
+	RuntimeLOD.Primitives[1].UVs.AddDefaulted(1);
+	RuntimeLOD.Primitives[1].UVs[0] = { FVector2D(0, 0), FVector2D(1, 0), FVector2D(1, 1), FVector2D(0, 1) };
+
+	UE::Geometry::FDynamicMesh3 Mesh;
+	glTFRuntimeAlembic::BuildDynamicMesh(RuntimeLOD, Mesh);
+
+	TestEqual("Mesh.TriangleCount() == 4", Mesh.TriangleCount(), 4);
+	TestEqual("Mesh.VertexCount() == 8", Mesh.VertexCount(), 8);
+	TestEqual("Mesh.Attributes()->NumUVLayers() == 1", Mesh.Attributes()->NumUVLayers(), 1);
+	TestEqual("Mesh.Attributes()->GetMaterialID()->GetValue(3) == 1", Mesh.Attributes()->GetMaterialID()->GetValue(3), 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Mesh_DynamicMeshUpdate, "glTFRuntime.Alembic.UnitTests.Mesh.DynamicMeshUpdate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Mesh_DynamicMeshUpdate::RunTest(const FString& Parameters)
+{
+	FglTFRuntimeMeshLOD RuntimeLOD;
+	RuntimeLOD.Primitives.AddDefaulted(2);
+	for (FglTFRuntimePrimitive& Primitive : RuntimeLOD.Primitives)
+	{
+		Primitive.Positions = { FVector(0, 0, 0), FVector(1, 0, 0), FVector(1, 1, 0), FVector(0, 1, 0) };
+		Primitive.Normals = { FVector::UpVector, FVector::UpVector, FVector::UpVector, FVector::UpVector };
+		Primitive.Indices = { 0, 1, 2, 0, 2, 3 };
+	}
+
+	UE::Geometry::FDynamicMesh3 Mesh;
+	glTFRuntimeAlembic::FDynamicMeshVertexLayout Layout;
+	glTFRuntimeAlembic::BuildDynamicMesh(RuntimeLOD, Mesh, &Layout);
+
+	TestEqual("Layout.NumVertices == 8", Layout.NumVertices, 8);
+	TestEqual("Layout.PrimitivesFirstVertexID[1] == 4", Layout.PrimitivesFirstVertexID[1], 4);
+
+	RuntimeLOD.Primitives[1].Positions[2] = FVector(2, 2, 1);
+	RuntimeLOD.Primitives[1].Normals[2] = FVector::ForwardVector;
+
+	TestTrue("UpdateDynamicMeshVertices(RuntimeLOD, Layout, Mesh, true, false)", glTFRuntimeAlembic::UpdateDynamicMeshVertices(RuntimeLOD, Layout, Mesh, true, false));
+	TestEqual("Mesh.GetVertex(6) == FVector3d(2, 2, 1)", Mesh.GetVertex(6), FVector3d(2, 2, 1));
+	TestEqual("Mesh.Attributes()->PrimaryNormals()->GetElement(6) == FVector3f::UpVector", Mesh.Attributes()->PrimaryNormals()->GetElement(6), FVector3f::UpVector);
+
+	TestTrue("UpdateDynamicMeshVertices(RuntimeLOD, Layout, Mesh, false, true)", glTFRuntimeAlembic::UpdateDynamicMeshVertices(RuntimeLOD, Layout, Mesh, false, true));
+	TestEqual("Mesh.Attributes()->PrimaryNormals()->GetElement(6) == FVector3f::ForwardVector", Mesh.Attributes()->PrimaryNormals()->GetElement(6), FVector3f::ForwardVector);
+
+	// blend straight into the mesh
+	FglTFRuntimeMeshLOD NextRuntimeLOD = RuntimeLOD;
+	NextRuntimeLOD.Primitives[1].Positions[2] = FVector(4, 4, 1);
+	NextRuntimeLOD.Primitives[1].Normals[2] = FVector::UpVector;
+	TestTrue("LerpDynamicMeshVertices(RuntimeLOD, NextRuntimeLOD, 0.5f, Layout, Mesh)", glTFRuntimeAlembic::LerpDynamicMeshVertices(RuntimeLOD, NextRuntimeLOD, 0.5f, Layout, Mesh));
+	TestEqual("Mesh.GetVertex(6) == FVector3d(3, 3, 1)", Mesh.GetVertex(6), FVector3d(3, 3, 1));
+	TestTrue("Mesh.Attributes()->PrimaryNormals()->GetElement(6).IsNormalized()", Mesh.Attributes()->PrimaryNormals()->GetElement(6).IsNormalized());
+
+	// a different vertex count requires a full rebuild
+	RuntimeLOD.Primitives[0].Positions.Pop();
+	TestFalse("UpdateDynamicMeshVertices(RuntimeLOD, Layout, Mesh, true, true)", glTFRuntimeAlembic::UpdateDynamicMeshVertices(RuntimeLOD, Layout, Mesh, true, true));
+	TestFalse("LerpDynamicMeshVertices(RuntimeLOD, NextRuntimeLOD, 0.5f, Layout, Mesh)", glTFRuntimeAlembic::LerpDynamicMeshVertices(RuntimeLOD, NextRuntimeLOD, 0.5f, Layout, Mesh));
+
+	glTFRuntimeAlembic::FMeshSampleVersion Version;
+	Version.TopologyKey = 1;
+	Version.PositionsTrueSampleIndex = 1;
+	glTFRuntimeAlembic::FMeshSampleVersion OtherVersion = Version;
+	OtherVersion.PositionsTrueSampleIndex = 2;
+
+	TestTrue("Version.HasSameTopology(OtherVersion)", Version.HasSameTopology(OtherVersion));
+	TestFalse("Version.HasSamePositions(OtherVersion)", Version.HasSamePositions(OtherVersion));
+	// generated normals follow the positions
+	TestFalse("Version.HasSameNormals(OtherVersion)", Version.HasSameNormals(OtherVersion));
+
+	Version.NormalsTrueSampleIndex = 0;
+	OtherVersion.NormalsTrueSampleIndex = 0;
+	TestTrue("Version.HasSameNormals(OtherVersion)", Version.HasSameNormals(OtherVersion));
+	TestFalse("FMeshSampleVersion().HasSameTopology(FMeshSampleVersion())", glTFRuntimeAlembic::FMeshSampleVersion().HasSameTopology(glTFRuntimeAlembic::FMeshSampleVersion()));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Mesh_PlaybackSampleIndex, "glTFRuntime.Alembic.UnitTests.Mesh.PlaybackSampleIndex", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Mesh_PlaybackSampleIndex::RunTest(const FString& Parameters)
+{
+	float PlaybackTime = 0.5f;
+	TestEqual("GetPlaybackSampleIndex(0.5, 24, 24, true) == 12", glTFRuntimeAlembic::GetPlaybackSampleIndex(PlaybackTime, 24, 24, true), 12);
+
+	PlaybackTime = 1.25f;
+	TestEqual("GetPlaybackSampleIndex(1.25, 24, 24, true) == 6", glTFRuntimeAlembic::GetPlaybackSampleIndex(PlaybackTime, 24, 24, true), 6);
+	TestEqual("PlaybackTime == 0.25", PlaybackTime, 0.25f);
+
+	PlaybackTime = -0.25f;
+	TestEqual("GetPlaybackSampleIndex(-0.25, 24, 24, true) == 18", glTFRuntimeAlembic::GetPlaybackSampleIndex(PlaybackTime, 24, 24, true), 18);
+
+	PlaybackTime = 2;
+	TestEqual("GetPlaybackSampleIndex(2, 24, 24, false) == 23", glTFRuntimeAlembic::GetPlaybackSampleIndex(PlaybackTime, 24, 24, false), 23);
+	TestEqual("PlaybackTime == 1", PlaybackTime, 1.0f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Mesh_Interpolation, "glTFRuntime.Alembic.UnitTests.Mesh.Interpolation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Mesh_Interpolation::RunTest(const FString& Parameters)
+{
+	// 5 vectors (15 doubles) cover both the vector and the scalar paths
+	TArray<FVector> From = { FVector(0, 0, 0), FVector(1, 2, 3), FVector(-1, -2, -3), FVector(10, 20, 30), FVector(4, 5, 6) };
+	TArray<FVector> To = { FVector(2, 2, 2), FVector(1, 2, 3), FVector(1, 2, 3), FVector(0, 0, 0), FVector(8, 10, 12) };
+
+	TArray<FVector> Positions;
+	Positions.AddUninitialized(From.Num());
+	glTFRuntimeAlembic::LerpPositions(From, To, 0.25f, Positions);
+
+	TestEqual("Positions[0] == FVector(0.5, 0.5, 0.5)", Positions[0], FVector(0.5, 0.5, 0.5));
+	TestEqual("Positions[1] == FVector(1, 2, 3)", Positions[1], FVector(1, 2, 3));
+	TestEqual("Positions[2] == FVector(-0.5, -1, -1.5)", Positions[2], FVector(-0.5, -1, -1.5));
+	TestEqual("Positions[3] == FVector(7.5, 15, 22.5)", Positions[3], FVector(7.5, 15, 22.5));
+	TestEqual("Positions[4] == FVector(5, 6.25, 7.5)", Positions[4], FVector(5, 6.25, 7.5));
+
+	glTFRuntimeAlembic::IntegrateVelocities(From, To, 0.5f);
+
+	TestEqual("From[0] == FVector(1, 1, 1)", From[0], FVector(1, 1, 1));
+	TestEqual("From[3] == FVector(10, 20, 30)", From[3], FVector(10, 20, 30));
+	TestEqual("From[4] == FVector(8, 10, 12)", From[4], FVector(8, 10, 12));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Mesh_InterpolationError, "glTFRuntime.Alembic.UnitTests.Mesh.InterpolationError", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Mesh_InterpolationError::RunTest(const FString& Parameters)
+{
+	const TArray<FVector> From = { FVector(0, 0, 0), FVector(10, 0, 0) };
+	const TArray<FVector> To = { FVector(0, 0, 10), FVector(10, 0, 10) };
+	TArray<FVector> Positions = { FVector(0, 0, 5), FVector(10, 0, 5.05) };
+
+	TestTrue("IsInterpolationWithinError(From, To, Positions, 0.5, 0.1)", glTFRuntimeAlembic::IsInterpolationWithinError(From, To, Positions, 0.5f, 0.1));
+	TestFalse("IsInterpolationWithinError(From, To, Positions, 0.5, 0.01)", glTFRuntimeAlembic::IsInterpolationWithinError(From, To, Positions, 0.5f, 0.01));
+	TestFalse("IsInterpolationWithinError(From, To, Positions, 0.25, 0.1)", glTFRuntimeAlembic::IsInterpolationWithinError(From, To, Positions, 0.25f, 0.1));
+
+	Positions.Pop();
+	TestFalse("IsInterpolationWithinError(From, To, Positions[0], 0.5, 0.1)", glTFRuntimeAlembic::IsInterpolationWithinError(From, To, Positions, 0.5f, 0.1));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Mesh_FrameStore, "glTFRuntime.Alembic.UnitTests.Mesh.FrameStore", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Mesh_FrameStore::RunTest(const FString& Parameters)
+{
+	// a grid slowly waving over 10 frames
+	constexpr int32 GridSize = 32;
+	TArray<FglTFRuntimeMeshLOD> Frames;
+	Frames.AddDefaulted(10);
+	for (int32 FrameIndex = 0; FrameIndex < Frames.Num(); FrameIndex++)
+	{
+		FglTFRuntimePrimitive& Primitive = Frames[FrameIndex].Primitives.AddDefaulted_GetRef();
+		for (int32 Y = 0; Y < GridSize; Y++)
+		{
+			for (int32 X = 0; X < GridSize; X++)
+			{
+				Primitive.Positions.Add(FVector(X * 10, Y * 10, FMath::Sin(X * 0.3 + FrameIndex * 0.05) * 5));
+				Primitive.Normals.Add(FVector(0, -0.6, X % 2 ? 0.8 : -0.8));
+				Primitive.Tangents.Add(FVector4(1, 0, 0, Y % 2 ? 1 : -1));
+				if (X > 0 && Y > 0)
+				{
+					Primitive.Indices.Append({ static_cast<uint32>((Y - 1) * GridSize + X - 1), static_cast<uint32>(Y * GridSize + X), static_cast<uint32>((Y - 1) * GridSize + X) });
+				}
+			}
+		}
+	}
+
+	glTFRuntimeAlembic::FCompressedFrameStore FrameStore;
+	TestTrue("FrameStore.AddBlock(Frames[0-3])", FrameStore.AddBlock(TArrayView<const FglTFRuntimeMeshLOD>(Frames.GetData(), 4)));
+	TestTrue("FrameStore.AddBlock(Frames[4-9])", FrameStore.AddBlock(TArrayView<const FglTFRuntimeMeshLOD>(Frames.GetData() + 4, 6)));
+	TestEqual("FrameStore.NumFrames() == 10", FrameStore.NumFrames(), 10);
+	TestTrue("FrameStore.GetCompressionRatio() > 4", FrameStore.GetCompressionRatio() > 4);
+
+	FglTFRuntimeMeshLOD RuntimeLOD;
+	TestTrue("FrameStore.DecodeFrame(7, RuntimeLOD)", FrameStore.DecodeFrame(7, RuntimeLOD));
+	TestEqual("RuntimeLOD.Primitives[0].Indices == Frames[7].Primitives[0].Indices", RuntimeLOD.Primitives[0].Indices, Frames[7].Primitives[0].Indices);
+	TestTrue("RuntimeLOD.Primitives[0].Positions[100].Equals(Frames[7].Primitives[0].Positions[100], 0.01)", RuntimeLOD.Primitives[0].Positions[100].Equals(Frames[7].Primitives[0].Positions[100], 0.01));
+	TestTrue("RuntimeLOD.Primitives[0].Normals[101].Equals(Frames[7].Primitives[0].Normals[101], 0.001)", RuntimeLOD.Primitives[0].Normals[101].Equals(Frames[7].Primitives[0].Normals[101], 0.001));
+	TestEqual("RuntimeLOD.Primitives[0].Tangents[0].W == -1", RuntimeLOD.Primitives[0].Tangents[0].W, -1.0);
+	TestFalse("FrameStore.DecodeFrame(10, RuntimeLOD)", FrameStore.DecodeFrame(10, RuntimeLOD));
+
+	// the layout is defined by the first frame
+	Frames[0].Primitives[0].Indices.Pop();
+	TestFalse("FrameStore.AddBlock(Frames[0])", FrameStore.AddBlock(TArrayView<const FglTFRuntimeMeshLOD>(Frames.GetData(), 1)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Mesh_MergePrimitives, "glTFRuntime.Alembic.UnitTests.Mesh.MergePrimitives", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Mesh_MergePrimitives::RunTest(const FString& Parameters)
+{
+	auto AddTriangle = [](FglTFRuntimeMeshLOD& RuntimeLOD, const FString& MaterialName, const FVector& Offset)
+		{
+			FglTFRuntimePrimitive& Primitive = RuntimeLOD.Primitives.AddDefaulted_GetRef();
+			Primitive.Positions = { Offset, Offset + FVector(1, 0, 0), Offset + FVector(0, 1, 0) };
+			Primitive.Normals = { FVector::UpVector, FVector::UpVector, FVector::UpVector };
+			Primitive.Indices = { 0, 1, 2 };
+			Primitive.MaterialName = MaterialName;
+		};
+
+	FglTFRuntimeMeshLOD RuntimeLOD;
+	AddTriangle(RuntimeLOD, "Wood", FVector(0, 0, 0));
+	AddTriangle(RuntimeLOD, "Glass", FVector(10, 0, 0));
+	AddTriangle(RuntimeLOD, "Wood", FVector(20, 0, 0));
+
+	UglTFRuntimeABCFunctionLibrary::TransformRuntimeLOD(RuntimeLOD, FTransform(FRotator(0, 0, 90), FVector(0, 0, 100), FVector(1, 1, 2)));
+	TestEqual("RuntimeLOD.Primitives[0].Positions[0] == FVector(0, 0, 100)", RuntimeLOD.Primitives[0].Positions[0], FVector(0, 0, 100));
+	TestTrue("RuntimeLOD.Primitives[0].Normals[0].IsNormalized()", RuntimeLOD.Primitives[0].Normals[0].IsNormalized());
+
+	// mirroring reverses the winding
+	FglTFRuntimeMeshLOD MirroredRuntimeLOD = RuntimeLOD;
+	UglTFRuntimeABCFunctionLibrary::TransformRuntimeLOD(MirroredRuntimeLOD, FTransform(FRotator::ZeroRotator, FVector::ZeroVector, FVector(-1, 1, 1)));
+	TestEqual("MirroredRuntimeLOD.Primitives[0].Indices[1] == 2", MirroredRuntimeLOD.Primitives[0].Indices[1], 2u);
+	TestEqual("MirroredRuntimeLOD.Primitives[0].Indices[2] == 1", MirroredRuntimeLOD.Primitives[0].Indices[2], 1u);
+
+	UglTFRuntimeABCFunctionLibrary::MergeRuntimeLODPrimitives(RuntimeLOD);
+
+	TestEqual("RuntimeLOD.Primitives.Num() == 2", RuntimeLOD.Primitives.Num(), 2);
+	if (RuntimeLOD.Primitives.Num() != 2)
+	{
+		return false;
+	}
+
+	const FglTFRuntimePrimitive& Wood = RuntimeLOD.Primitives[0];
+	TestEqual("Wood.MaterialName == Wood", Wood.MaterialName, FString("Wood"));
+	TestEqual("Wood.Positions.Num() == 6", Wood.Positions.Num(), 6);
+	TestEqual("Wood.Normals.Num() == 6", Wood.Normals.Num(), 6);
+	TestEqual("Wood.Indices.Num() == 6", Wood.Indices.Num(), 6);
+	// the indices of the second triangle are rebased
+	TestEqual("Wood.Indices[5] == 5", Wood.Indices[5], 5u);
+	TestEqual("RuntimeLOD.Primitives[1].Positions.Num() == 3", RuntimeLOD.Primitives[1].Positions.Num(), 3);
+
+	return true;
+}
+
+#endif
\ No newline at end of file
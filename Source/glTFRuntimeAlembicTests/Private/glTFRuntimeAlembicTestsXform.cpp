@@ -0,0 +1,493 @@
+// Copyright 2025 - Roberto De Ioris
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "glTFRuntimeAlembicTests.h"
+#include "glTFRuntimeABC.h"
+#include "glTFRuntimeABCXform.h"
+#include "Misc/AutomationTest.h"
+
+namespace glTFRuntimeAlembic
+{
+	namespace Tests
+	{
+		// in-memory scalar property, every sample is stored as changed
+		struct FSyntheticScalarProperty
+		{
+			template<typename T>
+			FSyntheticScalarProperty(const FString& Name, const EglTFRuntimeAlembicPODType PODType, const uint8 Extent, const TArray<TArray<T>>& Samples)
+			{
+				TSharedRef<FOgawaGroup> Group = MakeShared<FOgawaGroup>();
+				Buffers.AddDefaulted(Samples.Num());
+				for (int32 SampleIndex = 0; SampleIndex < Samples.Num(); SampleIndex++)
+				{
+					// 16 bytes of hash followed by the values
+					Buffers[SampleIndex].AddZeroed(16);
+					Buffers[SampleIndex].Append(reinterpret_cast<const uint8*>(Samples[SampleIndex].GetData()), Samples[SampleIndex].Num() * sizeof(T));
+
+					TSharedRef<FOgawaData> Data = MakeShared<FOgawaData>();
+					Data->Data = TArrayView64<uint8>(Buffers[SampleIndex].GetData(), Buffers[SampleIndex].Num());
+					Group->Children.Add(Data);
+				}
+
+				const uint32 NumSamples = Samples.Num();
+				Property = MakeShared<FScalarProperty>(Name, PODType, Extent, TMap<FString, FString>(), Group, NumSamples, NumSamples > 1 ? 1 : 0, NumSamples > 1 ? NumSamples - 1 : 0, 0);
+			}
+
+			TArray<TArray<uint8>> Buffers;
+			TSharedPtr<FScalarProperty> Property;
+		};
+
+		// the previous per-value implementation: a data lookup for every op and value and a matrix product for every op
+		bool BuildMatrixPerValue(const uint32 OpsTrueSampleIndex, const TSharedRef<FScalarProperty>& Ops, const uint32 ValsTrueSampleIndex, const TSharedRef<FScalarProperty>& Vals, FMatrix& Matrix)
+		{
+			Matrix.SetIdentity();
+			uint8 CurrentValsOffset = 0;
+			for (uint8 ExtentIndex = 0; ExtentIndex < Ops->Extent; ExtentIndex++)
+			{
+				uint8 OpTypeAsUint8;
+				if (!Ops->Get(OpsTrueSampleIndex, ExtentIndex, OpTypeAsUint8))
+				{
+					return false;
+				}
+
+				const EglTFRuntimeAlembicXformOpType OpType = static_cast<EglTFRuntimeAlembicXformOpType>((OpTypeAsUint8 >> 4) & 0xF);
+				double Values[4] = {};
+				const uint8 NumValues = (OpType == EglTFRuntimeAlembicXformOpType::Translate || OpType == EglTFRuntimeAlembicXformOpType::Scale) ? 3 : 1;
+				for (uint8 ValueIndex = 0; ValueIndex < NumValues; ValueIndex++)
+				{
+					if (!Vals->Get(ValsTrueSampleIndex, CurrentValsOffset++, Values[ValueIndex]))
+					{
+						return false;
+					}
+				}
+
+				FMatrix OpMatrix = FMatrix::Identity;
+				switch (OpType)
+				{
+				case(EglTFRuntimeAlembicXformOpType::Translate):
+					OpMatrix = FTranslationMatrix(FVector(Values[0], Values[1], Values[2]));
+					break;
+				case(EglTFRuntimeAlembicXformOpType::Scale):
+					OpMatrix = FScaleMatrix(FVector(Values[0], Values[1], Values[2]));
+					break;
+				case(EglTFRuntimeAlembicXformOpType::RotateX):
+					OpMatrix = FQuatRotationMatrix(FQuat(FVector(1, 0, 0), FMath::DegreesToRadians(Values[0])));
+					break;
+				case(EglTFRuntimeAlembicXformOpType::RotateY):
+					OpMatrix = FQuatRotationMatrix(FQuat(FVector(0, 1, 0), FMath::DegreesToRadians(Values[0])));
+					break;
+				case(EglTFRuntimeAlembicXformOpType::RotateZ):
+					OpMatrix = FQuatRotationMatrix(FQuat(FVector(0, 0, 1), FMath::DegreesToRadians(Values[0])));
+					break;
+				default:
+					return false;
+				}
+
+				Matrix = OpMatrix * Matrix;
+			}
+
+			return true;
+		}
+
+		uint8 MakeXformOp(const EglTFRuntimeAlembicXformOpType OpType)
+		{
+			return static_cast<uint8>(OpType) << 4;
+		}
+
+		// in-memory object with a translate only .xform (one sample per translation), Storage keeps the property data alive
+		TSharedRef<FObject> MakeSyntheticXform(const TSharedPtr<FObject>& Parent, const FString& Name, const TArray<FVector>& Translations, const bool bInherits, TArray<TUniquePtr<FSyntheticScalarProperty>>& Storage)
+		{
+			TSharedRef<FObject> Object = MakeShared<FObject>(Parent, Name, TMap<FString, FString>());
+			Object->Properties = MakeShared<FCompoundProperty>("", TMap<FString, FString>());
+			if (Parent)
+			{
+				Parent->Children.Add(Object);
+			}
+
+			if (Translations.Num() == 0)
+			{
+				return Object;
+			}
+
+			TArray<TArray<double>> ValsSamples;
+			for (const FVector& Translation : Translations)
+			{
+				ValsSamples.Add({ Translation.X, Translation.Y, Translation.Z });
+			}
+
+			FSyntheticScalarProperty* Ops = Storage.Add_GetRef(MakeUnique<FSyntheticScalarProperty>(".ops", EglTFRuntimeAlembicPODType::Uint8, 1, TArray<TArray<uint8>>{ { MakeXformOp(EglTFRuntimeAlembicXformOpType::Translate) } })).Get();
+			FSyntheticScalarProperty* Vals = Storage.Add_GetRef(MakeUnique<FSyntheticScalarProperty>(".vals", EglTFRuntimeAlembicPODType::Float64, 3, ValsSamples)).Get();
+			FSyntheticScalarProperty* Inherits = Storage.Add_GetRef(MakeUnique<FSyntheticScalarProperty>(".inherits", EglTFRuntimeAlembicPODType::Boolean, 1, TArray<TArray<uint8>>{ { static_cast<uint8>(bInherits ? 1 : 0) } })).Get();
+
+			TSharedRef<FCompoundProperty> Xform = MakeShared<FCompoundProperty>(".xform", TMap<FString, FString>());
+			Xform->Children.Add(Ops->Property.ToSharedRef());
+			Xform->Children.Add(Vals->Property.ToSharedRef());
+			Xform->Children.Add(Inherits->Property.ToSharedRef());
+			Object->Properties->Children.Add(Xform);
+
+			return Object;
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Xform_BlenderDefaultTrack, "glTFRuntime.Alembic.UnitTests.Xform.BlenderDefaultTrack", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Xform_BlenderDefaultTrack::RunTest(const FString& Parameters)
+{
+	glTFRuntimeAlembic::Tests::FFixture Fixture("blender_default.abc");
+
+	TSharedPtr<glTFRuntimeAlembic::IOgawaNode> Root = glTFRuntimeAlembic::ParseOgawaBlob(Fixture.Blob);
+
+	TSharedPtr<glTFRuntimeAlembic::FObject> RootObject = glTFRuntimeAlembic::ParseArchive(Root->Group().ToSharedRef());
+
+	TSharedPtr<glTFRuntimeAlembic::FObject> Cube = RootObject->GetChild("Cube");
+
+	TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FXformTrack> Tracks;
+	glTFRuntimeAlembic::BakeXformTracks(*RootObject, Tracks);
+
+	const glTFRuntimeAlembic::FXformTrack* Track = Tracks.Find(Cube.Get());
+	TestTrue("Tracks.Find(Cube) != nullptr", Track != nullptr);
+	if (!Track)
+	{
+		return false;
+	}
+
+	TestFalse("Track->IsAnimated()", Track->IsAnimated());
+	TestEqual("Track->Translations.Num() == 1", Track->Translations.Num(), 1);
+
+	TSharedPtr<glTFRuntimeAlembic::FScalarProperty> OpsProperty = Cube->FindScalarProperty(".xform/.ops");
+	TSharedPtr<glTFRuntimeAlembic::FScalarProperty> ValsProperty = Cube->FindScalarProperty(".xform/.vals");
+	FMatrix Matrix;
+	TestTrue("BuildMatrix(...)", glTFRuntimeAlembic::BuildMatrix(0, OpsProperty.ToSharedRef(), 0, ValsProperty.ToSharedRef(), Matrix));
+	TestTrue("Track->GetTransform(0).Equals(FTransform(Matrix), 0.001)", Track->GetTransform(0).Equals(FTransform(Matrix), 0.001));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Xform_TrackInterpolation, "glTFRuntime.Alembic.UnitTests.Xform.TrackInterpolation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Xform_TrackInterpolation::RunTest(const FString& Parameters)
+{
+	glTFRuntimeAlembic::FXformTrack Track;
+	Track.NumSamples = 3;
+	Track.Translations = { FVector3f(0, 0, 0), FVector3f(10, 0, 0), FVector3f(20, 0, 0) };
+	Track.Rotations = { FQuat4f::Identity, FQuat4f::Identity, FQuat4f::Identity };
+	Track.Scales = { FVector3f::OneVector, FVector3f::OneVector, FVector3f::OneVector };
+
+	Track.CollapseConstantChannels();
+
+	TestEqual("Track.Translations.Num() == 3", Track.Translations.Num(), 3);
+	TestEqual("Track.Rotations.Num() == 1", Track.Rotations.Num(), 1);
+	TestEqual("Track.Scales.Num() == 1", Track.Scales.Num(), 1);
+	TestTrue("Track.IsAnimated()", Track.IsAnimated());
+
+	TestEqual("Track.GetTransform(1, 0.5).GetTranslation() == FVector(15, 0, 0)", Track.GetTransform(1, 0.5f).GetTranslation(), FVector(15, 0, 0));
+	// the last sample is held
+	TestEqual("Track.GetTransform(2, 0.5).GetTranslation() == FVector(20, 0, 0)", Track.GetTransform(2, 0.5f).GetTranslation(), FVector(20, 0, 0));
+	TestEqual("Track.GetTransform(5).GetTranslation() == FVector(20, 0, 0)", Track.GetTransform(5).GetTranslation(), FVector(20, 0, 0));
+	TestEqual("Track.GetTransform(1).GetScale3D() == FVector::OneVector", Track.GetTransform(1).GetScale3D(), FVector::OneVector);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Xform_BuildTransform, "glTFRuntime.Alembic.UnitTests.Xform.BuildTransform", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Xform_BuildTransform::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeAlembic::Tests;
+
+	constexpr int32 NumSamples = 100000;
+
+	// Blender/Maya style stack: translate, rotate XYZ, scale
+	const TArray<uint8> TRSOps = { MakeXformOp(EglTFRuntimeAlembicXformOpType::Translate), MakeXformOp(EglTFRuntimeAlembicXformOpType::RotateX), MakeXformOp(EglTFRuntimeAlembicXformOpType::RotateY), MakeXformOp(EglTFRuntimeAlembicXformOpType::RotateZ), MakeXformOp(EglTFRuntimeAlembicXformOpType::Scale) };
+	// scale before translate, not a TRS order
+	const TArray<uint8> SwappedOps = { MakeXformOp(EglTFRuntimeAlembicXformOpType::Scale), MakeXformOp(EglTFRuntimeAlembicXformOpType::RotateZ), MakeXformOp(EglTFRuntimeAlembicXformOpType::RotateY), MakeXformOp(EglTFRuntimeAlembicXformOpType::RotateX), MakeXformOp(EglTFRuntimeAlembicXformOpType::Translate) };
+
+	TArray<TArray<double>> ValsSamples;
+	ValsSamples.AddDefaulted(NumSamples);
+	FRandomStream RandomStream(42);
+	for (TArray<double>& Vals : ValsSamples)
+	{
+		Vals = { RandomStream.FRandRange(-100, 100), RandomStream.FRandRange(-100, 100), RandomStream.FRandRange(-100, 100),
+			RandomStream.FRandRange(-180, 180), RandomStream.FRandRange(-180, 180), RandomStream.FRandRange(-180, 180),
+			RandomStream.FRandRange(0.5, 2), RandomStream.FRandRange(0.5, 2), RandomStream.FRandRange(0.5, 2) };
+	}
+
+	FSyntheticScalarProperty Ops(".ops", EglTFRuntimeAlembicPODType::Uint8, TRSOps.Num(), TArray<TArray<uint8>>{ TRSOps });
+	FSyntheticScalarProperty Swapped(".ops", EglTFRuntimeAlembicPODType::Uint8, SwappedOps.Num(), TArray<TArray<uint8>>{ SwappedOps });
+	FSyntheticScalarProperty Vals(".vals", EglTFRuntimeAlembicPODType::Float64, 9, ValsSamples);
+
+	double GetExtentValues[9];
+	TestTrue("Vals.Property->GetExtent(5, ...)", Vals.Property->GetExtent(5, MakeArrayView(GetExtentValues, 9)));
+	TestEqual("GetExtentValues[6] == ValsSamples[4][6]", GetExtentValues[6], ValsSamples[4][6]);
+	TestFalse("Vals.Property->GetExtent(..., 8 values)", Vals.Property->GetExtent(5, MakeArrayView(GetExtentValues, 8)));
+
+	for (int32 SampleIndex = 0; SampleIndex < 1000; SampleIndex++)
+	{
+		uint32 TrueIndex = 0;
+		Vals.Property->GetSampleTrueIndex(SampleIndex, TrueIndex);
+
+		FMatrix ReferenceMatrix;
+		FTransform Transform;
+		BuildMatrixPerValue(0, Ops.Property.ToSharedRef(), TrueIndex, Vals.Property.ToSharedRef(), ReferenceMatrix);
+		glTFRuntimeAlembic::BuildTransform(0, Ops.Property.ToSharedRef(), TrueIndex, Vals.Property.ToSharedRef(), Transform);
+		if (!Transform.ToMatrixWithScale().Equals(ReferenceMatrix, 0.001))
+		{
+			AddError(FString::Printf(TEXT("TRS sample %d does not match the matrix path"), SampleIndex));
+			return false;
+		}
+
+		// not composable as TRS (the non uniform scale is applied after the rotation), BuildMatrix must still match and BuildTransform must take the matrix fallback
+		BuildMatrixPerValue(0, Swapped.Property.ToSharedRef(), TrueIndex, Vals.Property.ToSharedRef(), ReferenceMatrix);
+		FMatrix Matrix;
+		glTFRuntimeAlembic::BuildMatrix(0, Swapped.Property.ToSharedRef(), TrueIndex, Vals.Property.ToSharedRef(), Matrix);
+		if (!Matrix.Equals(ReferenceMatrix, 0.001))
+		{
+			AddError(FString::Printf(TEXT("Swapped sample %d does not match the matrix path"), SampleIndex));
+			return false;
+		}
+
+		if (!glTFRuntimeAlembic::BuildTransform(0, Swapped.Property.ToSharedRef(), TrueIndex, Vals.Property.ToSharedRef(), Transform))
+		{
+			AddError(FString::Printf(TEXT("Swapped sample %d has no transform"), SampleIndex));
+			return false;
+		}
+	}
+
+	// identity ops
+	FSyntheticScalarProperty NoOps(".ops", EglTFRuntimeAlembicPODType::Uint8, 0, TArray<TArray<uint8>>{ TArray<uint8>() });
+	FSyntheticScalarProperty NoVals(".vals", EglTFRuntimeAlembicPODType::Float64, 0, TArray<TArray<double>>{ TArray<double>() });
+	FTransform Identity;
+	TestTrue("BuildTransform(NoOps)", glTFRuntimeAlembic::BuildTransform(0, NoOps.Property.ToSharedRef(), 0, NoVals.Property.ToSharedRef(), Identity));
+	TestTrue("Identity.Equals(FTransform::Identity)", Identity.Equals(FTransform::Identity));
+
+	// benchmark, 100k animated xforms
+	uint64 ReferenceCycles = 0;
+	uint64 TransformCycles = 0;
+	FVector Checksum = FVector::ZeroVector;
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex++)
+		{
+			FMatrix Matrix;
+			BuildMatrixPerValue(0, Ops.Property.ToSharedRef(), SampleIndex, Vals.Property.ToSharedRef(), Matrix);
+			Checksum += FTransform(Matrix).GetTranslation();
+		}
+		ReferenceCycles = FPlatformTime::Cycles64() - StartCycles;
+	}
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex++)
+		{
+			FTransform Transform;
+			glTFRuntimeAlembic::BuildTransform(0, Ops.Property.ToSharedRef(), SampleIndex, Vals.Property.ToSharedRef(), Transform);
+			Checksum -= Transform.GetTranslation();
+		}
+		TransformCycles = FPlatformTime::Cycles64() - StartCycles;
+	}
+
+	TestTrue("Checksum.IsNearlyZero(0.1)", Checksum.IsNearlyZero(0.1));
+
+	AddInfo(FString::Printf(TEXT("%d xforms: per value matrix %.2f ms, BuildTransform %.2f ms"), NumSamples, FPlatformTime::ToMilliseconds64(ReferenceCycles), FPlatformTime::ToMilliseconds64(TransformCycles)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Xform_WorldMatrices, "glTFRuntime.Alembic.UnitTests.Xform.WorldMatrices", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Xform_WorldMatrices::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeAlembic::Tests;
+
+	TArray<TUniquePtr<FSyntheticScalarProperty>> Storage;
+	TSharedRef<glTFRuntimeAlembic::FObject> Root = MakeSyntheticXform(nullptr, "", {}, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> A = MakeSyntheticXform(Root, "A", { FVector(10, 0, 0), FVector(20, 0, 0) }, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> B = MakeSyntheticXform(A, "B", { FVector(0, 5, 0) }, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> C = MakeSyntheticXform(A, "C", { FVector(0, 0, 1) }, false, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> D = MakeSyntheticXform(B, "D", {}, true, Storage);
+
+	glTFRuntimeAlembic::FXformHierarchy Hierarchy;
+	Hierarchy.Build(*Root);
+
+	TestEqual("Hierarchy.Num() == 5", Hierarchy.Num(), 5);
+	TestEqual("Hierarchy.LevelOffsets.Num() == 5", Hierarchy.LevelOffsets.Num(), 5);
+	TestEqual("Hierarchy.GetNumSamples() == 2", Hierarchy.GetNumSamples(), 2);
+
+	const int32 BIndex = Hierarchy.GetObjectIndex(*B);
+	const int32 CIndex = Hierarchy.GetObjectIndex(*C);
+	const int32 DIndex = Hierarchy.GetObjectIndex(*D);
+	TestTrue("Hierarchy.ParentIndices[DIndex] == BIndex", Hierarchy.ParentIndices[DIndex] == BIndex);
+
+	TArray<FMatrix> WorldMatrices;
+	TestTrue("Hierarchy.EvaluateWorldMatrices(0, ...)", Hierarchy.EvaluateWorldMatrices(0, WorldMatrices));
+	TestEqual("WorldMatrices[BIndex].GetOrigin() == FVector(10, 5, 0)", WorldMatrices[BIndex].GetOrigin(), FVector(10, 5, 0));
+	// non inheriting
+	TestEqual("WorldMatrices[CIndex].GetOrigin() == FVector(0, 0, 1)", WorldMatrices[CIndex].GetOrigin(), FVector(0, 0, 1));
+	// no xform
+	TestEqual("WorldMatrices[DIndex].GetOrigin() == FVector(10, 5, 0)", WorldMatrices[DIndex].GetOrigin(), FVector(10, 5, 0));
+
+	// static children hold their only sample
+	TestTrue("Hierarchy.EvaluateWorldMatrices(5, ...)", Hierarchy.EvaluateWorldMatrices(5, WorldMatrices));
+	TestEqual("WorldMatrices[DIndex].GetOrigin() == FVector(20, 5, 0)", WorldMatrices[DIndex].GetOrigin(), FVector(20, 5, 0));
+
+	TestTrue("Hierarchy.EvaluateWorldMatrices(0.5, 1, ...)", Hierarchy.EvaluateWorldMatrices(0.5f, 1.0f, WorldMatrices));
+	TestEqual("WorldMatrices[BIndex].GetOrigin() == FVector(15, 5, 0)", WorldMatrices[BIndex].GetOrigin(), FVector(15, 5, 0));
+
+	// a real archive, the cube has no xform parent
+	glTFRuntimeAlembic::Tests::FFixture Fixture("blender_default.abc");
+
+	TSharedPtr<glTFRuntimeAlembic::IOgawaNode> OgawaRoot = glTFRuntimeAlembic::ParseOgawaBlob(Fixture.Blob);
+
+	TSharedPtr<glTFRuntimeAlembic::FObject> RootObject = glTFRuntimeAlembic::ParseArchive(OgawaRoot->Group().ToSharedRef());
+
+	TSharedPtr<glTFRuntimeAlembic::FObject> Cube = RootObject->GetChild("Cube");
+
+	Hierarchy.Build(*RootObject);
+	TestTrue("Hierarchy.EvaluateWorldMatrices(0, ...) (blender_default)", Hierarchy.EvaluateWorldMatrices(0, WorldMatrices));
+
+	FMatrix Matrix;
+	glTFRuntimeAlembic::BuildMatrix(0, Cube->FindScalarProperty(".xform/.ops").ToSharedRef(), 0, Cube->FindScalarProperty(".xform/.vals").ToSharedRef(), Matrix);
+	TestTrue("WorldMatrices[Cube].Equals(Matrix)", WorldMatrices[Hierarchy.GetObjectIndex(*Cube)].Equals(Matrix));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Xform_RigidSkeleton, "glTFRuntime.Alembic.UnitTests.Xform.RigidSkeleton", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Xform_RigidSkeleton::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeAlembic::Tests;
+
+	auto MakePolyMesh = [](const TSharedRef<glTFRuntimeAlembic::FObject>& Parent, const FString& Name)
+		{
+			TSharedRef<glTFRuntimeAlembic::FObject> PolyMesh = MakeShared<glTFRuntimeAlembic::FObject>(Parent, Name, TMap<FString, FString>{ { "schema", "AbcGeom_PolyMesh_v1" } });
+			PolyMesh->Properties = MakeShared<glTFRuntimeAlembic::FCompoundProperty>("", TMap<FString, FString>());
+			Parent->Children.Add(PolyMesh);
+			return PolyMesh;
+		};
+
+	TArray<TUniquePtr<FSyntheticScalarProperty>> Storage;
+	TSharedRef<glTFRuntimeAlembic::FObject> Root = MakeSyntheticXform(nullptr, "", {}, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> Part = MakeSyntheticXform(Root, "Part", { FVector(1, 0, 0) }, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> PartMesh = MakePolyMesh(Part, "PartShape");
+	// a group without xform does not get a bone
+	TSharedRef<glTFRuntimeAlembic::FObject> Group = MakeSyntheticXform(Part, "Group", {}, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> SubPart = MakeSyntheticXform(Group, "Part", { FVector(0, 1, 0) }, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> SubPartMesh = MakePolyMesh(SubPart, "SubPartShape");
+
+	glTFRuntimeAlembic::FRigidSkeleton RigidSkeleton;
+	TestTrue("RigidSkeleton.Build(*Root)", RigidSkeleton.Build(*Root));
+
+	TestEqual("RigidSkeleton.Bones.Num() == 3", RigidSkeleton.Bones.Num(), 3);
+	TestEqual("RigidSkeleton.Meshes.Num() == 2", RigidSkeleton.Meshes.Num(), 2);
+	if (RigidSkeleton.Bones.Num() != 3 || RigidSkeleton.Meshes.Num() != 2)
+	{
+		return false;
+	}
+
+	TestEqual("RigidSkeleton.Bones[0].Name == root", RigidSkeleton.Bones[0].Name, FString("root"));
+	TestTrue("RigidSkeleton.Bones[1].Object == Part", RigidSkeleton.Bones[1].Object == &Part.Get());
+	TestTrue("RigidSkeleton.Bones[2].Object == SubPart", RigidSkeleton.Bones[2].Object == &SubPart.Get());
+	TestEqual("RigidSkeleton.Bones[2].ParentIndex == 1", RigidSkeleton.Bones[2].ParentIndex, 1);
+	// names are unique
+	TestEqual("RigidSkeleton.Bones[2].Name == Part_1", RigidSkeleton.Bones[2].Name, FString("Part_1"));
+
+	for (const glTFRuntimeAlembic::FRigidSkeleton::FRigidMesh& RigidMesh : RigidSkeleton.Meshes)
+	{
+		TestEqual("RigidMesh.BoneIndex", RigidMesh.BoneIndex, RigidMesh.Object == &PartMesh.Get() ? 1 : 2);
+	}
+
+	TestFalse("RigidSkeleton.Build(*SubPartMesh) (no polymeshes below)", RigidSkeleton.Build(*SubPartMesh));
+
+	// a non inheriting xform hangs from the root bone, out of the world matrix of the root (and of the objects above it)
+	TSharedRef<glTFRuntimeAlembic::FObject> Scene = MakeSyntheticXform(nullptr, "", { FVector(0, 0, 1000) }, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> Top = MakeSyntheticXform(Scene, "Top", { FVector(100, 0, 0) }, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> Arm = MakeSyntheticXform(Top, "Arm", { FVector(0, 10, 0) }, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> Free = MakeSyntheticXform(Arm, "Free", { FVector(0, 0, 5) }, false, Storage);
+	MakePolyMesh(Free, "FreeShape");
+
+	TestTrue("RigidSkeleton.Build(*Top)", RigidSkeleton.Build(*Top));
+	TestEqual("RigidSkeleton.Bones.Num() == 3 (non inheriting)", RigidSkeleton.Bones.Num(), 3);
+	if (RigidSkeleton.Bones.Num() != 3)
+	{
+		return false;
+	}
+
+	TestFalse("RigidSkeleton.Bones[2].bInherits", RigidSkeleton.Bones[2].bInherits);
+	TestEqual("RigidSkeleton.Bones[2].ParentIndex == 0", RigidSkeleton.Bones[2].ParentIndex, 0);
+
+	TArray<glTFRuntimeAlembic::FXformTrack> Tracks;
+	Tracks.SetNum(RigidSkeleton.Bones.Num());
+	for (int32 BoneIndex = 0; BoneIndex < RigidSkeleton.Bones.Num(); BoneIndex++)
+	{
+		glTFRuntimeAlembic::BakeXformTrack(*RigidSkeleton.Bones[BoneIndex].Object, Tracks[BoneIndex]);
+	}
+
+	TestEqual("RigidSkeleton.GetBoneTransform(Tracks, 1, 0) (inheriting)", RigidSkeleton.GetBoneTransform(Tracks, 1, 0).GetTranslation(), FVector(0, 10, 0));
+	TestEqual("RigidSkeleton.GetBoneTransform(Tracks, 2, 0) (non inheriting)", RigidSkeleton.GetBoneTransform(Tracks, 2, 0).GetTranslation(), FVector(-100, 0, -995));
+	TestFalse("RigidSkeleton.IsBoneAnimated(Tracks, 2)", RigidSkeleton.IsBoneAnimated(Tracks, 2));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FglTFRuntimeAlembicTests_Xform_VisibilityTracks, "glTFRuntime.Alembic.UnitTests.Xform.VisibilityTracks", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FglTFRuntimeAlembicTests_Xform_VisibilityTracks::RunTest(const FString& Parameters)
+{
+	using namespace glTFRuntimeAlembic::Tests;
+
+	TArray<TUniquePtr<FSyntheticScalarProperty>> Storage;
+	auto AddVisible = [&Storage](const TSharedRef<glTFRuntimeAlembic::FObject>& Object, const TArray<TArray<int8>>& Samples)
+		{
+			FSyntheticScalarProperty* Visible = Storage.Add_GetRef(MakeUnique<FSyntheticScalarProperty>("visible", EglTFRuntimeAlembicPODType::Int8, 1, Samples)).Get();
+			Object->Properties->Children.Add(Visible->Property.ToSharedRef());
+		};
+
+	TSharedRef<glTFRuntimeAlembic::FObject> Root = MakeSyntheticXform(nullptr, "", {}, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> A = MakeSyntheticXform(Root, "A", {}, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> B = MakeSyntheticXform(A, "B", {}, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> C = MakeSyntheticXform(A, "C", {}, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> D = MakeSyntheticXform(Root, "D", {}, true, Storage);
+	TSharedRef<glTFRuntimeAlembic::FObject> E = MakeSyntheticXform(Root, "E", {}, true, Storage);
+	AddVisible(A, { { 1 }, { 0 }, { 0 }, { 1 } });
+	// deferred, follows A
+	AddVisible(B, { { -1 } });
+	AddVisible(C, { { 0 } });
+	AddVisible(D, { { 1 }, { -1 } });
+
+	TMap<const glTFRuntimeAlembic::FObject*, glTFRuntimeAlembic::FVisibilityTrack> Tracks;
+	glTFRuntimeAlembic::BakeVisibilityTracks(*Root, Tracks);
+
+	TestEqual("Tracks.Num() == 3", Tracks.Num(), 3);
+	TestFalse("Tracks.Contains(D)", Tracks.Contains(&D.Get()));
+	TestFalse("Tracks.Contains(E)", Tracks.Contains(&E.Get()));
+
+	const glTFRuntimeAlembic::FVisibilityTrack* ATrack = Tracks.Find(&A.Get());
+	const glTFRuntimeAlembic::FVisibilityTrack* BTrack = Tracks.Find(&B.Get());
+	const glTFRuntimeAlembic::FVisibilityTrack* CTrack = Tracks.Find(&C.Get());
+	if (!ATrack || !BTrack || !CTrack)
+	{
+		AddError("Missing visibility tracks");
+		return false;
+	}
+
+	TestTrue("ATrack->IsAnimated()", ATrack->IsAnimated());
+	TestTrue("ATrack->IsVisible(0)", ATrack->IsVisible(0));
+	TestFalse("ATrack->IsVisible(1)", ATrack->IsVisible(1));
+	TestTrue("ATrack->IsVisible(10)", ATrack->IsVisible(10));
+	TestFalse("ATrack->IsVisibleInRange(1, 2)", ATrack->IsVisibleInRange(1, 2));
+	TestTrue("ATrack->IsVisibleInRange(2, 1 + 8)", ATrack->IsVisibleInRange(2, 1 + 8));
+	TestTrue("ATrack->IsVisibleInRange(2, -6)", ATrack->IsVisibleInRange(2, -6));
+
+	TestEqual("BTrack->NumSamples() == 4", BTrack->NumSamples(), 4);
+	TestFalse("BTrack->IsVisible(2)", BTrack->IsVisible(2));
+	TestTrue("BTrack->IsVisible(3)", BTrack->IsVisible(3));
+
+	// hidden by itself over the whole range, collapsed to a single sample
+	TestTrue("CTrack->IsAlwaysHidden()", CTrack->IsAlwaysHidden());
+	TestFalse("CTrack->IsAnimated()", CTrack->IsAnimated());
+
+	return true;
+}
+
+#endif
\ No newline at end of file